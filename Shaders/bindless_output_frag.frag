@@ -0,0 +1,13 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+#pragma shader_stage(fragment)
+
+layout (location = 0) in vec2 fragCoord;
+layout (location = 1) in vec4 fragColor;
+layout (location = 2) flat in uint fragTexture;
+layout(location = 0) out vec4 outColor;
+layout(set = 1, binding = 0) uniform sampler2D bindlessTextures[];
+
+void main() {
+    outColor = texture(bindlessTextures[nonuniformEXT(fragTexture)], fragCoord) * fragColor;
+}
\ No newline at end of file
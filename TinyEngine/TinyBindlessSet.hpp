@@ -0,0 +1,210 @@
+#ifndef TINY_ENGINE_TINYBINDLESSSET
+#define TINY_ENGINE_TINYBINDLESSSET
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Vertex with a per-vertex bindless texture index (see TinyBindlessSet).
+		struct TinyBindlessVertex {
+		public:
+			glm::vec2 texcoord;
+			glm::vec3 position;
+			glm::vec4 color;
+			uint32_t texture;
+
+			TinyBindlessVertex() : texcoord(glm::vec2(0.0)), position(glm::vec3(0.0)), color(glm::vec4(1.0)), texture(0) {};
+			TinyBindlessVertex(glm::vec2 tex, glm::vec3 pos, glm::vec4 col, uint32_t texture) : texcoord(tex), position(pos), color(col), texture(texture) {}
+			TinyBindlessVertex(TinyVertex vertex, uint32_t texture) : texcoord(vertex.texcoord), position(vertex.position), color(vertex.color), texture(texture) {}
+
+			static TinyVertexDescription GetVertexDescription() {
+				return TinyVertexDescription(GetBindingDescription(), GetAttributeDescriptions());
+			}
+
+			static VkVertexInputBindingDescription GetBindingDescription() {
+				return { .binding = 0, .stride = sizeof(TinyBindlessVertex), .inputRate = VK_VERTEX_INPUT_RATE_VERTEX };
+			}
+
+			static const std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions() {
+				return {
+					{ .binding = 0, .location = 0, .format = VK_FORMAT_R32G32_SFLOAT, .offset = offsetof(TinyBindlessVertex, texcoord) },
+					{ .binding = 0, .location = 1, .format = VK_FORMAT_R32G32B32_SFLOAT, .offset = offsetof(TinyBindlessVertex, position) },
+					{ .binding = 0, .location = 2, .format = VK_FORMAT_R32G32B32A32_SFLOAT, .offset = offsetof(TinyBindlessVertex, color) },
+					{ .binding = 0, .location = 3, .format = VK_FORMAT_R32_UINT, .offset = offsetof(TinyBindlessVertex, texture) }
+				};
+			}
+		};
+
+		/// @brief Image registered with a TinyBindlessSet and the handles of the set's hooks on the image's onDispose/onRecreate events.
+		struct TinyBindlessEntry {
+		public:
+			TinyImage* image = VK_NULL_HANDLE;
+			size_t disposeHandle = 0;
+			size_t recreateHandle = 0;
+		};
+
+		/// @brief Single large (VK_EXT_descriptor_indexing) sampled image array bound once per pass at descriptor set 1.
+		///
+		///     Images registered with the set are given a stable index (TinyImage::bindlessIndex) which shaders use to
+		///     index the array (nonuniformEXT) from vertex, instance or push constant data--so draws using different
+		///     textures no longer need a push descriptor write between them and can be merged into one draw.
+		///
+		///     Pipelines opt in via TinyPipelineCreateInfo::BindlessInfo(set.descriptorLayout) and the render event
+		///     binds the set with TinyRenderObject::BindBindlessSet(set).
+		///
+		///     Registered images release their index when disposed and have their descriptor re-written when re-created
+		///     (TinyImage::ResizeImage), so the set only ever references live images.
+		class TinyBindlessSet : public TinyDisposable {
+		public:
+			TinyVkDevice& vkdevice;
+			VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+			VkDescriptorSetLayout descriptorLayout = VK_NULL_HANDLE;
+			VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+			uint32_t maxDescriptors;
+
+			std::mutex registryLock;
+			std::vector<TinyBindlessEntry> images;
+			std::vector<uint32_t> freeIndices;
+			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
+
+			TinyBindlessSet operator=(const TinyBindlessSet&) = delete;
+			TinyBindlessSet(const TinyBindlessSet&) = delete;
+			~TinyBindlessSet() { this->Dispose(); }
+
+			void Disposable(bool waitIdle) {
+				VkDevice device = vkdevice.logicalDevice;
+				VkDescriptorPool descriptorPool = this->descriptorPool;
+				VkDescriptorSetLayout descriptorLayout = this->descriptorLayout;
+				vkdevice.deletionQueue.Push([device, descriptorPool, descriptorLayout]() {
+					if (descriptorPool != VK_NULL_HANDLE) vkDestroyDescriptorPool(device, descriptorPool, VK_NULL_HANDLE);
+					if (descriptorLayout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(device, descriptorLayout, VK_NULL_HANDLE);
+				}, waitIdle);
+				// Disposed images release themselves (onDispose), every image still registered is alive.
+				std::lock_guard<std::mutex> guard(registryLock);
+				for(TinyBindlessEntry& entry : images) if (entry.image != VK_NULL_HANDLE) Unregister(entry);
+				images.clear();
+				freeIndices.clear();
+				this->descriptorPool = VK_NULL_HANDLE;
+				this->descriptorLayout = VK_NULL_HANDLE;
+				descriptorSet = VK_NULL_HANDLE;
+			}
+
+			TinyBindlessSet(TinyVkDevice& vkdevice, uint32_t maxDescriptors = 4096U) : vkdevice(vkdevice), maxDescriptors(maxDescriptors) {
+				onDispose.hook(TinyCallback<bool>([this](bool forceDispose) {this->Disposable(forceDispose); }));
+				initialized = Initialize();
+			}
+
+			/// @brief Clamps the requested array size to the update-after-bind limits of the physical device.
+			uint32_t QueryMaxDescriptors(uint32_t requestedDescriptors) {
+				VkPhysicalDeviceDescriptorIndexingProperties indexingProperties = defaultDescriptorIndexingProperties;
+				VkPhysicalDeviceProperties2 properties = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &indexingProperties };
+				vkGetPhysicalDeviceProperties2(vkdevice.physicalDevice, &properties);
+
+				uint32_t deviceLimit = std::min({
+					indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages,
+					indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+					indexingProperties.maxDescriptorSetUpdateAfterBindSamplers,
+					indexingProperties.maxPerStageDescriptorUpdateAfterBindSamplers
+				});
+				return std::max(1U, std::min(requestedDescriptors, deviceLimit));
+			}
+
+			/// @brief Creates the update-after-bind, partially bound sampled image array layout (binding 0).
+			VkResult CreateDescriptorLayout() {
+				VkDescriptorBindingFlags bindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+				VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo { .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO, .bindingCount = 1, .pBindingFlags = &bindingFlags };
+				VkDescriptorSetLayoutBinding binding = TinyPipeline::GetPushDescriptorLayoutBinding(static_cast<TinyShaderStages>(STAGE_VERTEX | STAGE_FRAGMENT), 0, TinyDescriptorType::TYPE_IMAGE_SAMPLER, maxDescriptors);
+
+				VkDescriptorSetLayoutCreateInfo descriptorCreateInfo { .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, .pNext = &bindingFlagsInfo,
+					.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT, .bindingCount = 1, .pBindings = &binding };
+				return vkCreateDescriptorSetLayout(vkdevice.logicalDevice, &descriptorCreateInfo, VK_NULL_HANDLE, &descriptorLayout);
+			}
+
+			/// @brief Creates the update-after-bind descriptor pool and allocates the single bindless descriptor set.
+			VkResult CreateDescriptorSet() {
+				VkDescriptorPoolSize poolSize { .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = maxDescriptors };
+				VkDescriptorPoolCreateInfo poolCreateInfo { .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+					.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT, .maxSets = 1, .poolSizeCount = 1, .pPoolSizes = &poolSize };
+
+				VkResult result = vkCreateDescriptorPool(vkdevice.logicalDevice, &poolCreateInfo, VK_NULL_HANDLE, &descriptorPool);
+				if (result != VK_SUCCESS) return result;
+
+				VkDescriptorSetAllocateInfo allocInfo { .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, .descriptorPool = descriptorPool, .descriptorSetCount = 1, .pSetLayouts = &descriptorLayout };
+				return vkAllocateDescriptorSets(vkdevice.logicalDevice, &allocInfo, &descriptorSet);
+			}
+
+			/// @brief Writes the image's descriptor into its bindless array slot (image is sampled as LAYOUT_SHADER_READONLY).
+			VkResult WriteDescriptor(TinyImage& image) {
+				if (image.bindlessIndex >= maxDescriptors || image.imageView == VK_NULL_HANDLE) return VK_ERROR_INITIALIZATION_FAILED;
+
+				VkDescriptorImageInfo imageDescriptor = { image.imageSampler, image.imageView, (VkImageLayout) TinyImageLayout::LAYOUT_SHADER_READONLY };
+				VkWriteDescriptorSet imageDescriptorSet = TinyImage::GetWriteDescriptor(0, 1, &imageDescriptor);
+				imageDescriptorSet.dstSet = descriptorSet;
+				imageDescriptorSet.dstArrayElement = image.bindlessIndex;
+				vkUpdateDescriptorSets(vkdevice.logicalDevice, 1, &imageDescriptorSet, 0, VK_NULL_HANDLE);
+				return VK_SUCCESS;
+			}
+
+			/// @brief Registers an image with the bindless array and returns its stable index (UINT32_MAX if the array is full).
+			uint32_t RegisterImage(TinyImage& image) {
+				std::lock_guard<std::mutex> guard(registryLock);
+				if (image.bindlessIndex < images.size() && images[image.bindlessIndex].image == &image) return image.bindlessIndex;
+
+				uint32_t index = UINT32_MAX;
+				if (freeIndices.size() > 0) {
+					index = freeIndices.back();
+					freeIndices.pop_back();
+				} else if (images.size() < maxDescriptors) {
+					index = static_cast<uint32_t>(images.size());
+					images.push_back({});
+				}
+
+				image.bindlessIndex = index;
+				if (index == UINT32_MAX) return index;
+
+				TinyCallback<bool> disposeCallback([this, &image](bool forceDispose) { this->ReleaseImage(image); });
+				TinyCallback<TinyImage&> recreateCallback([this](TinyImage& recreated) { this->UpdateImage(recreated); });
+				image.onDispose.hook(disposeCallback);
+				image.onRecreate.hook(recreateCallback);
+				images[index] = { &image, disposeCallback.hash_code(), recreateCallback.hash_code() };
+
+				WriteDescriptor(image);
+				return index;
+			}
+
+			/// @brief Re-writes a registered image's descriptor (call after the image's view/sampler are re-created, e.g. on resize).
+			VkResult UpdateImage(TinyImage& image) {
+				std::lock_guard<std::mutex> guard(registryLock);
+				if (image.bindlessIndex >= images.size() || images[image.bindlessIndex].image != &image) return VK_ERROR_INITIALIZATION_FAILED;
+				return WriteDescriptor(image);
+			}
+
+			/// @brief Removes an image from the bindless array, its index is recycled for the next registered image.
+			/// Draws recorded against the index must have completed before the index is re-registered.
+			void ReleaseImage(TinyImage& image) {
+				std::lock_guard<std::mutex> guard(registryLock);
+				if (image.bindlessIndex >= images.size() || images[image.bindlessIndex].image != &image) return;
+				freeIndices.push_back(image.bindlessIndex);
+				Unregister(images[image.bindlessIndex]);
+			}
+
+			/// @brief Unhooks the set from the entry's image and clears the entry (caller holds registryLock).
+			void Unregister(TinyBindlessEntry& entry) {
+				entry.image->onDispose.unhook(entry.disposeHandle);
+				entry.image->onRecreate.unhook(entry.recreateHandle);
+				entry.image->bindlessIndex = UINT32_MAX;
+				entry = {};
+			}
+
+			VkResult Initialize() {
+				maxDescriptors = QueryMaxDescriptors(maxDescriptors);
+				VkResult result = CreateDescriptorLayout();
+				if (result != VK_SUCCESS) return result;
+				result = CreateDescriptorSet();
+
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Created bindless image set [" << maxDescriptors << " descriptors]" << std::endl;
+				#endif
+				return result;
+			}
+		};
+	}
+#endif
\ No newline at end of file
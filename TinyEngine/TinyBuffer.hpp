@@ -13,6 +13,7 @@
 			VmaAllocationInfo description;
 			const TinyBufferType bufferType;
 			VkDeviceSize size;
+			TinyResourceState resourceState;
 			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
 			
 			TinyBuffer operator=(const TinyBuffer&) = delete;
@@ -20,8 +21,10 @@
 			~TinyBuffer() { this->Dispose(); }
 
 			void Disposable(bool waitIdle) {
-				if (waitIdle) vkDeviceWaitIdle(vkdevice.logicalDevice);
-				vmaDestroyBuffer(vkdevice.memoryAllocator, buffer, memory);
+				VmaAllocator allocator = vkdevice.memoryAllocator;
+				VkBuffer buffer = this->buffer;
+				VmaAllocation memory = this->memory;
+				vkdevice.deletionQueue.Push([allocator, buffer, memory]() { vmaDestroyBuffer(allocator, buffer, memory); }, waitIdle);
 			}
 
 			TinyBuffer(TinyVkDevice& vkdevice, const TinyBufferType bufferType, VkDeviceSize dataSize)
@@ -36,65 +39,53 @@
 				return vmaCreateBuffer(vkdevice.memoryAllocator, &bufCreateInfo, &allocCreateInfo, &buffer, &memory, &description);
 			}
 
+			/// @brief Gets the stages/access masks for: STAGE_BEGIN (transfer writes -> buffer's consumer reads) or STAGE_END (consumer reads -> next transfer write).
 			void GetPipelineBarrierStages(TinyCmdBufferSubmitStage cmdBufferStage, VkPipelineStageFlags& srcStage, VkPipelineStageFlags& dstStage, VkAccessFlags& srcAccessMask, VkAccessFlags& dstAccessMask) {
+				VkPipelineStageFlags consumerStage;
+				VkAccessFlags consumerAccessMask;
+				switch(bufferType) {
+					case TinyBufferType::TYPE_STAGING:
+						consumerStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+						consumerAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+					break;
+					case TinyBufferType::TYPE_READBACK:
+						consumerStage = VK_PIPELINE_STAGE_HOST_BIT;
+						consumerAccessMask = VK_ACCESS_HOST_READ_BIT;
+					break;
+					case TinyBufferType::TYPE_VERTEX:
+						consumerStage = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+						consumerAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+					break;
+					case TinyBufferType::TYPE_INDEX:
+						consumerStage = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+						consumerAccessMask = VK_ACCESS_INDEX_READ_BIT;
+					break;
+					case TinyBufferType::TYPE_UNIFORM:
+					case TinyBufferType::TYPE_UNIFORM_MAPPED:
+						consumerStage = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+						consumerAccessMask = VK_ACCESS_UNIFORM_READ_BIT;
+					break;
+					case TinyBufferType::TYPE_STORAGE:
+						consumerStage = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+						consumerAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+					break;
+					case TinyBufferType::TYPE_INDIRECT:
+					default:
+						consumerStage = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+						consumerAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+					break;
+				}
+
 				if (cmdBufferStage == TinyCmdBufferSubmitStage::STAGE_BEGIN) {
-					switch(bufferType) {
-						case TinyBufferType::TYPE_STAGING:
-							srcAccessMask = VK_ACCESS_NONE;
-							dstAccessMask = VK_ACCESS_NONE;
-							srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-							dstStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-						break;
-						case TinyBufferType::TYPE_VERTEX:
-						case TinyBufferType::TYPE_INDEX:
-							srcAccessMask = VK_ACCESS_NONE;
-							dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-							srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-							dstStage = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
-						break;
-						case TinyBufferType::TYPE_UNIFORM:
-							srcAccessMask = VK_ACCESS_NONE;
-							dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-							srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-							dstStage = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-						break;
-						case TinyBufferType::TYPE_INDIRECT:
-						default:
-							srcAccessMask = VK_ACCESS_NONE;
-							dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
-							srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-							dstStage = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
-						break;
-					}
+					srcStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+					dstStage = consumerStage;
+					srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+					dstAccessMask = consumerAccessMask;
 				} else if (cmdBufferStage == TinyCmdBufferSubmitStage::STAGE_END) {
-					switch(bufferType) {
-						case TinyBufferType::TYPE_STAGING:
-							srcAccessMask = VK_ACCESS_NONE;
-							dstAccessMask = VK_ACCESS_NONE;
-							srcStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-							dstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-						break;
-						case TinyBufferType::TYPE_VERTEX:
-						case TinyBufferType::TYPE_INDEX:
-							srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-							dstAccessMask = VK_ACCESS_NONE;
-							srcStage = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
-							dstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-						break;
-						case TinyBufferType::TYPE_UNIFORM:
-							srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-							dstAccessMask = VK_ACCESS_NONE;
-							srcStage = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-							dstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-						break;
-						case TinyBufferType::TYPE_INDIRECT:
-						default:
-							srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
-							dstAccessMask = VK_ACCESS_NONE;
-							srcStage = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
-							dstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-						break;
-					}
+					srcStage = consumerStage;
+					dstStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+					srcAccessMask = VK_ACCESS_NONE;
+					dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 				} else if (cmdBufferStage == TinyCmdBufferSubmitStage::STAGE_BEGIN_TO_END) {
 					srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
 					dstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
@@ -102,13 +93,55 @@
 					dstAccessMask = VK_ACCESS_NONE;
 				}
 			}
+
+			VkBufferMemoryBarrier GetPipelineBarrier(TinyCmdBufferSubmitStage cmdBufferStage, VkPipelineStageFlags& srcStage, VkPipelineStageFlags& dstStage) {
+				VkBufferMemoryBarrier pipelineBarrier = {
+					.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+					.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+					.buffer = buffer, .offset = 0, .size = VK_WHOLE_SIZE
+				};
+
+				VkAccessFlags srcAccessMask, dstAccessMask;
+				GetPipelineBarrierStages(cmdBufferStage, srcStage, dstStage, srcAccessMask, dstAccessMask);
+				pipelineBarrier.srcAccessMask = srcAccessMask;
+				pipelineBarrier.dstAccessMask = dstAccessMask;
+				return pipelineBarrier;
+			}
+
+			/// @brief Synchronization2 barrier: destination stages/access from the buffer type table, source stages/access
+			/// from the buffer's tracked last access (falling back to the table when the buffer has not been accessed yet).
+			VkBufferMemoryBarrier2 GetPipelineBarrier2(TinyCmdBufferSubmitStage cmdBufferStage) {
+				VkPipelineStageFlags srcStage, dstStage;
+				VkAccessFlags srcAccessMask, dstAccessMask;
+				GetPipelineBarrierStages(cmdBufferStage, srcStage, dstStage, srcAccessMask, dstAccessMask);
+				VkPipelineStageFlags2 trackedStages = resourceState.writeStages | resourceState.readStages;
+
+				// Transfer writes recorded before this barrier (StageBufferToBuffer) are not tracked, keep the table's source for STAGE_BEGIN.
+				if (cmdBufferStage == TinyCmdBufferSubmitStage::STAGE_BEGIN || trackedStages == VK_PIPELINE_STAGE_2_NONE)
+					return { .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+						.srcStageMask = srcStage, .srcAccessMask = srcAccessMask, .dstStageMask = dstStage, .dstAccessMask = dstAccessMask,
+						.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .buffer = buffer, .offset = 0, .size = VK_WHOLE_SIZE };
+
+				return { .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+					.srcStageMask = trackedStages, .srcAccessMask = resourceState.writeAccess, .dstStageMask = dstStage, .dstAccessMask = dstAccessMask,
+					.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .buffer = buffer, .offset = 0, .size = VK_WHOLE_SIZE };
+			}
+
+			/// @brief Records a buffer barrier (outside of dynamic rendering only, e.g. in transfer passes after writing this buffer).
+			void PipelineBarrier(VkCommandBuffer cmdBuffer, TinyCmdBufferSubmitStage cmdBufferStage) {
+				VkBufferMemoryBarrier2 pipelineBarrier = GetPipelineBarrier2(cmdBufferStage);
+				resourceState.Synchronized(pipelineBarrier.dstStageMask, pipelineBarrier.dstAccessMask);
+
+				VkDependencyInfo dependencyInfo = { .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO, .bufferMemoryBarrierCount = 1, .pBufferMemoryBarriers = &pipelineBarrier };
+				vkCmdPipelineBarrier2EKHR(vkdevice.functions, cmdBuffer, &dependencyInfo);
+			}
 			
 			VkDescriptorBufferInfo GetDescriptorInfo(VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE) {
 				return { buffer, offset, range };
 			}
 			
-			inline static VkWriteDescriptorSet GetWriteDescriptor(uint32_t binding, uint32_t descriptorCount, const VkDescriptorBufferInfo* bufferInfo) {
-				return { .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, .pBufferInfo = bufferInfo, .dstSet = 0, .dstBinding = binding, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = descriptorCount };
+			inline static VkWriteDescriptorSet GetWriteDescriptor(uint32_t binding, uint32_t descriptorCount, const VkDescriptorBufferInfo* bufferInfo, TinyDescriptorType descriptorType = TinyDescriptorType::TYPE_UNIFORM_BUFFER) {
+				return { .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, .pBufferInfo = bufferInfo, .dstSet = 0, .dstBinding = binding, .descriptorType = static_cast<VkDescriptorType>(descriptorType), .descriptorCount = descriptorCount };
 			}
 			
 			VkResult Initialize() {
@@ -122,8 +155,17 @@
 					case TinyBufferType::TYPE_UNIFORM:
 						return CreateBuffer(size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
 					break;
+					case TinyBufferType::TYPE_UNIFORM_MAPPED:
+						return CreateBuffer(size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+					break;
+					case TinyBufferType::TYPE_STORAGE:
+						return CreateBuffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
+					break;
 					case TinyBufferType::TYPE_INDIRECT:
-						return CreateBuffer(size, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
+						return CreateBuffer(size, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
+					break;
+					case TinyBufferType::TYPE_READBACK:
+						return CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
 					break;
 					default: case TinyBufferType::TYPE_STAGING:
 						return CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
@@ -131,5 +173,245 @@
 				}
 			}
 		};
+
+		/// @brief Offset/range of a uniform block written into a TinyUniformRing (range 0 if the ring frame was full).
+		struct TinyUniformBlock {
+		public:
+			VkDeviceSize offset = 0;
+			VkDeviceSize range = 0;
+			void* mappedData = nullptr;
+
+			bool Valid() const { return range > 0; }
+		};
+
+		/// @brief Persistently mapped per-frame uniform ring buffer for per-draw uniform blocks.
+		///
+		///     One TYPE_UNIFORM_MAPPED buffer is split into frameCount slots of bytesPerFrame, blocks are sub-allocated
+		///     from the current frame's slot at minUniformBufferOffsetAlignment and bound with TinyRenderObject::PushUniform.
+		///     Call BeginFrame(frame) before writing each frame's blocks, a slot is only rewritten frameCount frames later.
+		///     Push descriptors cannot use UNIFORM_BUFFER_DYNAMIC, so blocks are bound with an explicit offset per draw instead.
+		class TinyUniformRing {
+		public:
+			TinyVkDevice& vkdevice;
+			const VkDeviceSize alignment, bytesPerFrame, frameCount;
+			TinyBuffer ringBuffer;
+			VkDeviceSize frameBase = 0;
+			std::atomic<VkDeviceSize> frameHead = 0;
+			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
+
+			TinyUniformRing operator=(const TinyUniformRing&) = delete;
+			TinyUniformRing(const TinyUniformRing&) = delete;
+
+			static VkDeviceSize QueryAlignment(TinyVkDevice& vkdevice) {
+				VkPhysicalDeviceProperties properties {};
+				vkGetPhysicalDeviceProperties(vkdevice.physicalDevice, &properties);
+				return std::max(static_cast<VkDeviceSize>(1), properties.limits.minUniformBufferOffsetAlignment);
+			}
+
+			static VkDeviceSize AlignUp(VkDeviceSize size, VkDeviceSize alignment) { return (size + alignment - 1) & ~(alignment - 1); }
+
+			/// @brief The ring buffer is owned (and disposed) by ringBuffer, the ring itself holds no other Vulkan resources.
+			TinyUniformRing(TinyVkDevice& vkdevice, VkDeviceSize bytesPerFrame, VkDeviceSize frameCount = 2)
+			: vkdevice(vkdevice), alignment(QueryAlignment(vkdevice)), bytesPerFrame(AlignUp(std::max(static_cast<VkDeviceSize>(1), bytesPerFrame), alignment)),
+			frameCount(std::max(static_cast<VkDeviceSize>(1), frameCount)), ringBuffer(vkdevice, TinyBufferType::TYPE_UNIFORM_MAPPED, this->bytesPerFrame * this->frameCount) {
+				initialized = ringBuffer.initialized;
+			}
+
+			/// @brief Selects the ring slot for this frame (e.g. TinyRenderGraph::frameCounter) and resets its allocations.
+			void BeginFrame(uint64_t frame) {
+				frameBase = (frame % frameCount) * bytesPerFrame;
+				frameHead = 0;
+			}
+
+			/// @brief Reserves an aligned block of byteSize in the current frame slot (thread-safe, lock-free).
+			TinyUniformBlock Allocate(VkDeviceSize byteSize) {
+				VkDeviceSize alignedSize = AlignUp(std::max(static_cast<VkDeviceSize>(1), byteSize), alignment);
+				VkDeviceSize offset = frameHead.fetch_add(alignedSize);
+				if (offset + alignedSize > bytesPerFrame || ringBuffer.description.pMappedData == nullptr) return {};
+				return { frameBase + offset, byteSize, static_cast<int8_t*>(ringBuffer.description.pMappedData) + frameBase + offset };
+			}
+
+			/// @brief Copies sourceData into a new block of the current frame slot.
+			TinyUniformBlock Push(const void* sourceData, VkDeviceSize byteSize) {
+				TinyUniformBlock block = Allocate(byteSize);
+				if (block.Valid()) memcpy(block.mappedData, sourceData, (size_t) byteSize);
+				return block;
+			}
+
+			template<typename T>
+			TinyUniformBlock Push(const T& sourceData) { return Push(&sourceData, sizeof(T)); }
+
+			VkDeviceSize BytesUsed() { return std::min(static_cast<VkDeviceSize>(frameHead), bytesPerFrame); }
+		};
+
+		/// @brief Sub-allocated range of a TinyBufferAllocator (size 0 if the allocation failed).
+		struct TinyBufferBlock {
+		public:
+			VkDeviceSize offset = 0;
+			VkDeviceSize size = 0;
+			void* mappedData = nullptr;
+
+			bool Valid() const { return size > 0; }
+		};
+
+		/// @brief Free-list sub-allocator over one persistently mapped buffer (e.g. staging memory for streamed uploads).
+		///
+		///     Unlike TinyUniformRing, blocks live until they are freed (e.g. once the upload's frame completes, see
+		///     TinyDeletionQueue), first-fit allocation with free neighbours coalesced on Free. Thread-safe.
+		class TinyBufferAllocator {
+		public:
+			TinyVkDevice& vkdevice;
+			const VkDeviceSize alignment;
+			TinyBuffer buffer;
+			std::mutex allocatorLock;
+			/// @brief Free ranges keyed by offset (offset -> size).
+			std::map<VkDeviceSize, VkDeviceSize> freeRanges;
+			VkDeviceSize bytesUsed = 0;
+			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
+
+			TinyBufferAllocator operator=(const TinyBufferAllocator&) = delete;
+			TinyBufferAllocator(const TinyBufferAllocator&) = delete;
+
+			/// @brief The buffer is owned (and disposed) by buffer, alignment must be a power of two (16 covers image copies of 4-16 byte texels).
+			TinyBufferAllocator(TinyVkDevice& vkdevice, VkDeviceSize size, TinyBufferType bufferType = TinyBufferType::TYPE_STAGING, VkDeviceSize alignment = 16)
+			: vkdevice(vkdevice), alignment(std::max(static_cast<VkDeviceSize>(1), alignment)), buffer(vkdevice, bufferType, size) {
+				initialized = (buffer.initialized == VK_SUCCESS && buffer.description.pMappedData == nullptr)? VK_ERROR_MEMORY_MAP_FAILED : buffer.initialized;
+				if (initialized == VK_SUCCESS) freeRanges[0] = buffer.size;
+			}
+
+			/// @brief Reserves an aligned block of byteSize, returns an invalid block if no free range fits.
+			TinyBufferBlock Allocate(VkDeviceSize byteSize) {
+				VkDeviceSize alignedSize = TinyUniformRing::AlignUp(std::max(static_cast<VkDeviceSize>(1), byteSize), alignment);
+				std::lock_guard<std::mutex> guard(allocatorLock);
+
+				for(auto range = freeRanges.begin(); range != freeRanges.end(); range++) {
+					if (range->second < alignedSize) continue;
+
+					VkDeviceSize offset = range->first, remaining = range->second - alignedSize;
+					freeRanges.erase(range);
+					if (remaining > 0) freeRanges[offset + alignedSize] = remaining;
+
+					bytesUsed += alignedSize;
+					return { offset, alignedSize, static_cast<int8_t*>(buffer.description.pMappedData) + offset };
+				}
+
+				return {};
+			}
+
+			/// @brief Returns the total free bytes (a single allocation may still fail due to fragmentation).
+			VkDeviceSize BytesFree() {
+				std::lock_guard<std::mutex> guard(allocatorLock);
+				return buffer.size - bytesUsed;
+			}
+
+			/// @brief Returns the block to the free list (merged with adjacent free ranges).
+			void Free(TinyBufferBlock block) {
+				if (!block.Valid()) return;
+				std::lock_guard<std::mutex> guard(allocatorLock);
+
+				VkDeviceSize offset = block.offset, size = block.size;
+				auto next = freeRanges.lower_bound(offset);
+				if (next != freeRanges.end() && offset + size == next->first) {
+					size += next->second;
+					next = freeRanges.erase(next);
+				}
+
+				if (next != freeRanges.begin()) {
+					auto previous = std::prev(next);
+					if (previous->first + previous->second == offset) {
+						previous->second += size;
+						bytesUsed -= block.size;
+						return;
+					}
+				}
+
+				freeRanges[offset] = size;
+				bytesUsed -= block.size;
+			}
+		};
+
+		/// @brief GPU data copied back to the CPU (see TinyRenderObject::ReadbackBuffer/ReadbackImage), result is an error if the readback was dropped.
+		struct TinyReadback {
+		public:
+			VkResult result = VK_ERROR_INITIALIZATION_FAILED;
+			/// @brief Format/extent of image readbacks (tightly packed rows), VK_FORMAT_UNDEFINED for buffer readbacks.
+			VkFormat format = VK_FORMAT_UNDEFINED;
+			uint32_t width = 0, height = 0;
+			std::vector<uint8_t> data;
+		};
+
+		/// @brief Host cached readback memory for copying GPU results back to the CPU without stalling (screenshots, picking, GPU computed data).
+		///
+		///     Copies are recorded into blocks of a TYPE_READBACK TinyBufferAllocator, each readback returns a future which is completed
+		///     once the frame timeline reaches the recording frame (see TinyDeletionQueue::Collect, called by the render graph after the
+		///     frame fence wait): frame N's readbacks are available at the start of a later frame, the queue/device is never waited on.
+		///     Readbacks require an attached frame timeline (a render graph with a swapchain), blocks are freed once their readback completes.
+		///     Futures are only completed by a Collect: on the render thread never wait on (get) a future before the next RenderSwapChain
+		///     (it would deadlock), check it with wait_for(0) or call Poll() first. Other threads may block on it.
+		class TinyReadbackRing {
+		public:
+			TinyVkDevice& vkdevice;
+			TinyBufferAllocator allocator;
+			std::atomic_size_t pendingReadbacks = 0;
+			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
+
+			TinyReadbackRing operator=(const TinyReadbackRing&) = delete;
+			TinyReadbackRing(const TinyReadbackRing&) = delete;
+
+			/// @brief Pending readbacks reference the ring, they are completed (waiting on the device) before it is destroyed.
+			~TinyReadbackRing() { if (pendingReadbacks > 0) vkdevice.deletionQueue.Flush(); }
+
+			TinyReadbackRing(TinyVkDevice& vkdevice, VkDeviceSize size = 16777216ULL)
+			: vkdevice(vkdevice), allocator(vkdevice, size, TinyBufferType::TYPE_READBACK, 16) {
+				initialized = allocator.initialized;
+			}
+
+			/// @brief Reserves a block for a copy of byteSize, invalid if the ring is full or no frame timeline is attached to complete the readback.
+			TinyBufferBlock Allocate(VkDeviceSize byteSize) {
+				TinyBufferBlock block = (vkdevice.deletionQueue.frameTimeline != VK_NULL_HANDLE)? allocator.Allocate(byteSize) : TinyBufferBlock {};
+
+				#if TINY_ENGINE_VALIDATION
+					if (!block.Valid()) std::cout << "TinyEngine: Dropped readback of " << byteSize << " Bytes (readback ring full or no frame timeline attached)." << std::endl;
+				#endif
+
+				return block;
+			}
+
+			/// @brief Returns an already completed readback with an error result (e.g. when no block could be allocated).
+			static std::future<TinyReadback> Failed(VkResult result) {
+				std::promise<TinyReadback> promise;
+				promise.set_value({ .result = result });
+				return promise.get_future();
+			}
+
+			/// @brief Returns a future for the block's copy (recorded in the pending frame), completed and freed by the first Collect (the next
+			///     RenderSwapChain or Poll) after that frame completes on the GPU.
+			std::future<TinyReadback> Complete(TinyBufferBlock block, VkDeviceSize byteSize, VkFormat format = VK_FORMAT_UNDEFINED, uint32_t width = 0, uint32_t height = 0) {
+				std::shared_ptr<std::promise<TinyReadback>> promise = std::make_shared<std::promise<TinyReadback>>();
+				std::future<TinyReadback> future = promise->get_future();
+				pendingReadbacks++;
+
+				vkdevice.deletionQueue.Push([this, block, byteSize, format, width, height, promise]() {
+					TinyReadback readback = { .result = vmaInvalidateAllocation(vkdevice.memoryAllocator, allocator.buffer.memory, block.offset, byteSize), .format = format, .width = width, .height = height };
+					if (readback.result == VK_SUCCESS) readback.data.assign(static_cast<const uint8_t*>(block.mappedData), static_cast<const uint8_t*>(block.mappedData) + byteSize);
+
+					allocator.Free(block);
+					pendingReadbacks--;
+					promise->set_value(std::move(readback));
+				}, true);
+				return future;
+			}
+
+			/// @brief Completes the readbacks (and other deferred releases) of every frame the GPU has completed (non-blocking), returns the number completed.
+			size_t Poll() { return (pendingReadbacks > 0)? vkdevice.deletionQueue.Collect() : 0; }
+
+			/// @brief Makes the copy into the block visible to the host (appended to the barrier recorded after the copy).
+			VkBufferMemoryBarrier2 GetHostReadBarrier(TinyBufferBlock block, VkDeviceSize byteSize) {
+				VkBufferMemoryBarrier2 hostBarrier = allocator.buffer.GetPipelineBarrier2(TinyCmdBufferSubmitStage::STAGE_BEGIN);
+				hostBarrier.offset = block.offset;
+				hostBarrier.size = byteSize;
+				return hostBarrier;
+			}
+		};
 	}
 #endif
\ No newline at end of file
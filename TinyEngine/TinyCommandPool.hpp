@@ -24,8 +24,9 @@
 
 			/// @brief Manually calls dispose on resources without deleting the object.
 			void Disposable(bool waitIdle) {
-				if (waitIdle) vkDeviceWaitIdle(vkdevice.logicalDevice);
-				vkDestroyCommandPool(vkdevice.logicalDevice, commandPool, VK_NULL_HANDLE);
+				VkDevice device = vkdevice.logicalDevice;
+				VkCommandPool commandPool = this->commandPool;
+				vkdevice.deletionQueue.Push([device, commandPool]() { vkDestroyCommandPool(device, commandPool, VK_NULL_HANDLE); }, waitIdle);
 			}
 			
 			/// @brief Creates a command pool to lease VkCommandBuffers from for recording render commands.
@@ -36,8 +37,7 @@
 
 			/// @brief Creates the underlying command pool with: VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT enabled.
 			VkResult CreateCommandPool() {
-				TinyQueueFamily queueFamily = QueryPhysicalDeviceQueueFamilies(vkdevice.physicalDevice, vkdevice.presentSurface);
-				VkCommandPoolCreateInfo poolInfo { .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, .queueFamilyIndex = queueFamily.graphicsFamily };
+				VkCommandPoolCreateInfo poolInfo { .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, .queueFamilyIndex = vkdevice.queueFamilyIndices.graphicsFamily };
                 return vkCreateCommandPool(vkdevice.logicalDevice, &poolInfo, VK_NULL_HANDLE, &commandPool);
 			}
 
@@ -59,13 +59,15 @@
 			/// @brief Reserves a VkCommandBuffer for use and returns the VkCommandBuffer and it's ID (used for returning to the pool).
 			std::pair<VkCommandBuffer,int32_t> LeaseBuffer(bool resetCmdBuffer = false) {
 				size_t index = 0;
-				for(auto& cmdBuffer : commandBuffers)
+				for(auto& cmdBuffer : commandBuffers) {
 					if (!cmdBuffer.second) {
 						cmdBuffer.second = true;
 						if (resetCmdBuffer)
                             vkResetCommandBuffer(cmdBuffer.first, VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT);
-						return std::pair(cmdBuffer.first, index++);
+						return std::pair(cmdBuffer.first, static_cast<int32_t>(index));
 					}
+					index++;
+				}
 				return std::pair<VkCommandBuffer,int32_t>(VK_NULL_HANDLE,-1);
 			}
 
@@ -32,6 +32,16 @@
     ///              VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME
     ///         Allows for writing descriptors directly into a command buffer rather than allocating from sets / pools.
     ///              VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME
+    ///         Allows for large partially bound (bindless) sampled image arrays indexed from within shaders.
+    ///              VK_KHR_MAINTENANCE_3_EXTENSION_NAME
+    ///              VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME
+    ///         Allows for GPU written draw counts when drawing indirect (vkCmdDrawIndirectCount).
+    ///              VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME
+    ///         Allows for 64-bit stage/access masks and batched barriers (vkCmdPipelineBarrier2, see TinyResourceTracker).
+    ///              VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME
+    ///         Optional (enabled only where supported) present identifiers and waits for low latency frame pacing (see TinyFramePacing).
+    ///              VK_KHR_PRESENT_ID_EXTENSION_NAME
+    ///              VK_KHR_PRESENT_WAIT_EXTENSION_NAME
     ///         Swapchain support for buffering frame images with the device driver to reduce tearing.
     ///         Only gets added if a window is added to the VkInstance on create via call to glfwGetRequiredInstanceExtensions.
     ///            * VK_KHR_SWAPCHAIN_EXTENSION_NAME
@@ -87,20 +97,59 @@
     #include <glm/glm.hpp>
     #include <glm/ext.hpp>
     using namespace glm;
+
+    ///
+    /// Optional PNG decoding (TinyImageLoader) via libspng: define TINY_ENGINE_PNG VK_TRUE, compile ./TinyEngine/Externals/spng.c
+    /// and link zlib (or define SPNG_USE_MINIZ and add miniz).
+    ///
+    #ifndef TINY_ENGINE_PNG
+        #define TINY_ENGINE_PNG VK_FALSE
+    #endif
+    #if TINY_ENGINE_PNG
+        #define SPNG_STATIC
+        #include "./Externals/spng.h"
+    #endif
+
+    ///
+    /// SSE2 pixel conversion kernels (TinyPixelConverter), defaults to VK_TRUE on x86/x64 targets (scalar kernels otherwise).
+    ///
+    #ifndef TINY_ENGINE_SIMD
+        #if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+            #define TINY_ENGINE_SIMD VK_TRUE
+        #else
+            #define TINY_ENGINE_SIMD VK_FALSE
+        #endif
+    #endif
+    #if TINY_ENGINE_SIMD
+        #include <emmintrin.h>
+    #endif
     
     ///
     /// General include libraries (data-structs, for-each search, etc.).
     ///
+    #include <atomic>
     #include <mutex>
+    #include <condition_variable>
+    #include <chrono>
+    #include <thread>
+    #include <future>
     #include <fstream>
     #include <iostream>
     #include <vector>
     #include <array>
+    #include <cstddef>
     #include <set>
+    #include <map>
     #include <string>
     #include <algorithm>
     #include <functional>
     #include <utility>
+    #if !defined (_WIN32)
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <unistd.h>
+    #endif
 
     #pragma region ENGINE_UTILITIES
         #include "./Utilities/TinyEnums.hpp"
@@ -108,21 +157,32 @@
         #include "./Utilities/TinyInvokableCallback.hpp"
         #include "./Utilities/TinyDisposable.hpp"
         #include "./Utilities/TinyUtilities.hpp"
+        #include "./Utilities/TinyDeletionQueue.hpp"
+        #include "./Utilities/TinyThreadPool.hpp"
+        #include "./Utilities/TinyMappedFile.hpp"
+        #include "./Utilities/TinyPixelConverter.hpp"
     #pragma endregion
     #pragma region ENGINE_INITIALIZATION
         #include "./TinyWindow.hpp"
         #include "./TinyVulkanDevice.hpp"
         #include "./TinyCommandPool.hpp"
         #include "./TinyPipeline.hpp"
+        #include "./TinyVertexLayout.hpp"
     #pragma endregion
     #pragma region ENGINE_RENDERING
         #include "./TinyBuffer.hpp"
         #include "./TinyImage.hpp"
+        #include "./TinyImageLoader.hpp"
+        #include "./TinyImageCooker.hpp"
+        #include "./TinyBindlessSet.hpp"
         #include "./TinySwapchain.hpp"
     #pragma endregion
     #pragma region ENGINE_RENDERGRAPH
         #include "./TinyMath.hpp"
+        #include "./TinyResourceTracker.hpp"
+        #include "./TinyUploadContext.hpp"
         #include "./TinyRenderPass.hpp"
+        #include "./TinyTextureStreamer.hpp"
         #include "./TinyRenderGraph.hpp"
     #pragma endregion
 #endif
@@ -149,6 +209,10 @@
 ///     Manually disposing dynamic memory keeps the object allive in the event that you need
 ///     to re-create its resources with different settings / input arguments.
 ///
+///     With a render graph, waitIdle = true defers destruction until the GPU completes the pending
+///     frame (TinyVkDevice::deletionQueue) rather than waiting on the whole device to idle;
+///     waitIdle = false destroys immediately (the caller guarantees the resources are unused).
+///
 ///     Manually instantiating objects via their constructors rather than using TinyObject<T>
 ///     means you'll manually need to call .Initialize() to actually initialize the object and get
 ///     it's VkResult for error handling.
@@ -11,11 +11,19 @@
 			VkImage image = VK_NULL_HANDLE;
 			VkImageView imageView = VK_NULL_HANDLE;
 			VkSampler imageSampler = VK_NULL_HANDLE;
+			uint32_t bindlessIndex = UINT32_MAX;
+			TinyResourceState resourceState;
+			/// @brief Invoked after ResizeImage re-creates the image, view & sampler (e.g. TinyBindlessSet re-writes the image's descriptor).
+			TinyInvokable<TinyImage&> onRecreate;
 
 			const TinyImageType imageType;
             VkDeviceSize width, height;
+			/// @brief Extent of the backing VkImage, may be larger than the render extent (width/height) after ResizeImage.
+			VkDeviceSize allocatedWidth, allocatedHeight;
             bool interpolation;
             VkFormat imageFormat;
+			/// @brief Number of mip levels (level 0 is width x height), see QueryFullMipLevels.
+			uint32_t mipLevels;
 			TinyImageLayout imageLayout;
 			VkImageAspectFlags aspectFlags;
 			VkSamplerAddressMode addressMode;
@@ -26,35 +34,62 @@
 			~TinyImage() { this->Dispose(); }
 
 			void Disposable(bool waitIdle) {
-				if (waitIdle) vkDeviceWaitIdle(vkdevice.logicalDevice);
-				if (imageType != TinyImageType::TYPE_SWAPCHAIN) {
-					if (imageSampler != VK_NULL_HANDLE) vkDestroySampler(vkdevice.logicalDevice, imageSampler, VK_NULL_HANDLE);
-					if (imageView != VK_NULL_HANDLE) vkDestroyImageView(vkdevice.logicalDevice, imageView, VK_NULL_HANDLE);
-					if (image != VK_NULL_HANDLE) vmaDestroyImage(vkdevice.memoryAllocator, image, memory);
-				}
+				if (imageType == TinyImageType::TYPE_SWAPCHAIN) return;
+				VkDevice device = vkdevice.logicalDevice;
+				VmaAllocator allocator = vkdevice.memoryAllocator;
+				VkImage image = this->image;
+				VmaAllocation memory = this->memory;
+				VkImageView imageView = this->imageView;
+				VkSampler imageSampler = this->imageSampler;
+
+				vkdevice.deletionQueue.Push([device, allocator, image, memory, imageView, imageSampler]() {
+					if (imageSampler != VK_NULL_HANDLE) vkDestroySampler(device, imageSampler, VK_NULL_HANDLE);
+					if (imageView != VK_NULL_HANDLE) vkDestroyImageView(device, imageView, VK_NULL_HANDLE);
+					if (image != VK_NULL_HANDLE) vmaDestroyImage(allocator, image, memory);
+				}, waitIdle);
+
+				// ResizeImage re-creates the image after disposing it, a failed re-creation must not leave destroyed handles behind.
+				this->image = VK_NULL_HANDLE;
+				this->memory = VK_NULL_HANDLE;
+				this->imageView = VK_NULL_HANDLE;
+				this->imageSampler = VK_NULL_HANDLE;
 			}
 
-            TinyImage(TinyVkDevice& vkdevice, const TinyImageType imageType, VkDeviceSize width, VkDeviceSize height, VkFormat imageFormat = VK_FORMAT_B8G8R8A8_UNORM, VkSamplerAddressMode addressMode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER, bool interpolation = false, VkImage imageSource = VK_NULL_HANDLE, VkImageView imageViewSource = VK_NULL_HANDLE, VkSampler imageSampler = VK_NULL_HANDLE)
-            : vkdevice(vkdevice), imageType(imageType), width(width), height(height), imageFormat(imageFormat), addressMode(addressMode), interpolation(interpolation), image(imageSource), imageView(imageViewSource), imageSampler(imageSampler) {
+            TinyImage(TinyVkDevice& vkdevice, const TinyImageType imageType, VkDeviceSize width, VkDeviceSize height, VkFormat imageFormat = VK_FORMAT_B8G8R8A8_UNORM, VkSamplerAddressMode addressMode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER, bool interpolation = false, VkImage imageSource = VK_NULL_HANDLE, VkImageView imageViewSource = VK_NULL_HANDLE, VkSampler imageSampler = VK_NULL_HANDLE, uint32_t mipLevels = 1)
+            : vkdevice(vkdevice), imageType(imageType), width(width), height(height), allocatedWidth(width), allocatedHeight(height), imageFormat(imageFormat), mipLevels(std::max<uint32_t>(1, mipLevels)), addressMode(addressMode), interpolation(interpolation), image(imageSource), imageView(imageViewSource), imageSampler(imageSampler) {
                 onDispose.hook(TinyCallback<bool>([this](bool forceDispose) {this->Disposable(forceDispose); }));
 				initialized = Initialize();
             }
 
-            VkResult CreateImage(TinyImageType type, VkDeviceSize width, VkDeviceSize height, VkFormat format = VK_FORMAT_R16G16B16A16_UNORM, VkSamplerAddressMode addressingMode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER, bool textureInterpolation = false) {
+            VkResult CreateImage(TinyImageType type, VkDeviceSize width, VkDeviceSize height, VkFormat format = VK_FORMAT_R8G8B8A8_UNORM, VkSamplerAddressMode addressingMode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER, bool textureInterpolation = false, uint32_t levels = 1) {
 				if (type == TinyImageType::TYPE_SWAPCHAIN) return VK_ERROR_INITIALIZATION_FAILED;
 
+				// Block-compressed images (BCn/ASTC) can only be sampled and copied, their support depends on the device (see TinyVkDevice::QueryFormatSupport).
+				bool compressed = QueryFormatCompressed(format);
+				if (compressed && (type == TinyImageType::TYPE_STORAGE || !vkdevice.QueryFormatSupport(format))) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				levels = std::min(std::max<uint32_t>(1, levels), QueryFullMipLevels(width, height));
+
 				VkImageCreateInfo imgCreateInfo = {
 					.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
 					.extent.width = static_cast<uint32_t>(width), .extent.height = static_cast<uint32_t>(height),
-					.extent.depth = 1, .mipLevels = 1, .arrayLayers = 1,
+					.extent.depth = 1, .mipLevels = levels, .arrayLayers = 1,
 					.format = format, .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED, .imageType = VK_IMAGE_TYPE_2D,
 					.tiling = VK_IMAGE_TILING_OPTIMAL, .samples = VK_SAMPLE_COUNT_1_BIT,
 					.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT
 				};
+
+				if (compressed) imgCreateInfo.usage &= ~VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+
+				// Storage images must use a format with VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT (e.g. R8G8B8A8_UNORM or R16G16B16A16_SFLOAT, B8G8R8A8 is not guaranteed).
+				if (type == TinyImageType::TYPE_STORAGE) imgCreateInfo.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
 				
 				this->width = width;
 				this->height = height;
+				this->allocatedWidth = width;
+				this->allocatedHeight = height;
+				this->mipLevels = levels;
 				this->imageLayout = TinyImageLayout::LAYOUT_UNDEFINED;
+				this->resourceState = {};
 				this->aspectFlags = VK_IMAGE_ASPECT_COLOR_BIT;
 				this->interpolation = interpolation;
 
@@ -80,7 +115,7 @@
 					.anisotropyEnable = VK_FALSE, .maxAnisotropy = properties.limits.maxSamplerAnisotropy,
 					.addressModeU = addressMode, .addressModeV = addressMode, .addressModeW = addressMode, .unnormalizedCoordinates = VK_FALSE,
 					.compareEnable = VK_FALSE, .compareOp = VK_COMPARE_OP_ALWAYS,
-					.mipmapMode = mipmapMode, .mipLodBias = 0.0f, .minLod = 0.0f, .maxLod = interpolationWeight,
+					.mipmapMode = mipmapMode, .mipLodBias = 0.0f, .minLod = 0.0f, .maxLod = (levels > 1)? static_cast<float>(levels) : interpolationWeight,
 					.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK,
 				};
 
@@ -90,7 +125,7 @@
 				VkImageViewCreateInfo createInfo {
 					.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
 					.image = image, .viewType = VK_IMAGE_VIEW_TYPE_2D, .format = imageFormat, .components = { VK_COMPONENT_SWIZZLE_IDENTITY },
-					.subresourceRange = { .baseMipLevel = 0, .levelCount = 1, .baseArrayLayer = 0, .layerCount = 1, .aspectMask = aspectFlags, }
+					.subresourceRange = { .baseMipLevel = 0, .levelCount = levels, .baseArrayLayer = 0, .layerCount = 1, .aspectMask = aspectFlags, }
 				};
 
 				return vkCreateImageView(vkdevice.logicalDevice, &createInfo, VK_NULL_HANDLE, &imageView);
@@ -202,7 +237,7 @@
 					.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
 					.oldLayout = (VkImageLayout) imageLayout, .newLayout = (VkImageLayout) newLayout,
 					.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-					.subresourceRange = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .baseMipLevel = 0, .levelCount = 1, .baseArrayLayer = 0, .layerCount = 1, },
+					.subresourceRange = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS, .baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS, },
 					.image = image,
 				};
 
@@ -213,20 +248,83 @@
 				return pipelineBarrier;
 			}
 
-			void TransitionLayoutBarrier(VkCommandBuffer cmdBuffer, TinyCmdBufferSubmitStage cmdBufferStage, TinyImageLayout newLayout) {
+			/// @brief Synchronization2 barrier: destination stages/access from the layout table, source stages/access from
+			/// the image's tracked last access (falling back to the table when the image has not been accessed yet).
+			VkImageMemoryBarrier2 GetPipelineBarrier2(TinyImageLayout newLayout, TinyCmdBufferSubmitStage cmdBufferStage) {
 				VkPipelineStageFlags srcStage, dstStage;
-				VkImageMemoryBarrier pipelineBarrier = GetPipelineBarrier(newLayout, cmdBufferStage, srcStage, dstStage);
+				VkAccessFlags srcAccessMask, dstAccessMask;
+				GetPipelineBarrierStages(newLayout, cmdBufferStage, srcStage, dstStage, srcAccessMask, dstAccessMask);
+
+				VkPipelineStageFlags2 trackedStages = resourceState.writeStages | resourceState.readStages;
+				if (imageLayout == TinyImageLayout::LAYOUT_PRESENT_SRC) trackedStages |= VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+				
+				return {
+					.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+					.srcStageMask = (trackedStages != VK_PIPELINE_STAGE_2_NONE)? trackedStages : static_cast<VkPipelineStageFlags2>(srcStage),
+					.srcAccessMask = (trackedStages != VK_PIPELINE_STAGE_2_NONE)? resourceState.writeAccess : static_cast<VkAccessFlags2>(srcAccessMask),
+					.dstStageMask = static_cast<VkPipelineStageFlags2>(dstStage), .dstAccessMask = static_cast<VkAccessFlags2>(dstAccessMask),
+					.oldLayout = (VkImageLayout) imageLayout, .newLayout = (VkImageLayout) newLayout,
+					.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .image = image,
+					.subresourceRange = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS, .baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS }
+				};
+			}
+
+			void TransitionLayoutBarrier(VkCommandBuffer cmdBuffer, TinyCmdBufferSubmitStage cmdBufferStage, TinyImageLayout newLayout) {
+				VkImageMemoryBarrier2 pipelineBarrier = GetPipelineBarrier2(newLayout, cmdBufferStage);
 				imageLayout = newLayout;
 				aspectFlags = pipelineBarrier.subresourceRange.aspectMask;
-				vkCmdPipelineBarrier(cmdBuffer, srcStage, dstStage, 0, 0, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, 1, &pipelineBarrier);
+				resourceState.Synchronized(pipelineBarrier.dstStageMask, pipelineBarrier.dstAccessMask);
+
+				VkDependencyInfo dependencyInfo = { .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO, .imageMemoryBarrierCount = 1, .pImageMemoryBarriers = &pipelineBarrier };
+				vkCmdPipelineBarrier2EKHR(vkdevice.functions, cmdBuffer, &dependencyInfo);
 			}
 			
+			/// @brief Returns the byte size of a tightly packed mip level (block-size aware for BCn/ASTC formats, 0 for unknown formats).
+			VkDeviceSize SizeofLevel(uint32_t level = 0) {
+				return QueryFormatLevelSize(imageFormat, std::max<VkDeviceSize>(1, allocatedWidth >> level), std::max<VkDeviceSize>(1, allocatedHeight >> level));
+			}
+
 			VkDescriptorImageInfo GetDescriptorInfo() {
                 return { imageSampler, imageView, (VkImageLayout) imageLayout };
             }
+
+			/// @brief Returns true if the allocation is larger than a fresh allocation with headroom for the current render extent (e.g. after shrinking).
+			bool Compactable(float headroom = 1.0f) {
+				return allocatedWidth > static_cast<VkDeviceSize>(std::ceil(width * headroom)) || allocatedHeight > static_cast<VkDeviceSize>(std::ceil(height * headroom));
+			}
+
+			/// @brief Resizes the render extent (width/height). The backing image is kept if the new extent fits the allocation, otherwise
+			///     (or if compact is set and the allocation is oversized) the image is re-created with headroom (allocation = extent * headroom).
+			///     The image must not be in use by the GPU if it may be re-created. Render passes use width/height for their render area,
+			///     shaders sampling a partially used allocation scale texcoords by GetUVScale().
+			VkResult ResizeImage(VkDeviceSize newWidth, VkDeviceSize newHeight, float headroom = 1.0f, bool compact = false) {
+				if (imageType == TinyImageType::TYPE_SWAPCHAIN) return VK_ERROR_INITIALIZATION_FAILED;
+
+				width = newWidth;
+				height = newHeight;
+				if (newWidth <= allocatedWidth && newHeight <= allocatedHeight && !(compact && Compactable(headroom)))
+					return VK_SUCCESS;
+
+				Disposable(false);
+				VkResult result = CreateImage(imageType, static_cast<VkDeviceSize>(std::ceil(newWidth * headroom)), static_cast<VkDeviceSize>(std::ceil(newHeight * headroom)), imageFormat, addressMode, interpolation, mipLevels);
+				width = newWidth;
+				height = newHeight;
+				if (result == VK_SUCCESS) onRecreate.invoke(*this);
+				return result;
+			}
+
+			/// @brief Texcoord scale mapping [0, 1] to the render extent within the (possibly larger) allocation.
+			glm::vec2 GetUVScale() {
+				return glm::vec2(static_cast<float>(width) / static_cast<float>(std::max<VkDeviceSize>(1, allocatedWidth)), static_cast<float>(height) / static_cast<float>(std::max<VkDeviceSize>(1, allocatedHeight)));
+			}
+
+			/// @brief Storage image descriptors are always accessed in LAYOUT_GENERAL and ignore the sampler.
+			VkDescriptorImageInfo GetStorageDescriptorInfo() {
+				return { VK_NULL_HANDLE, imageView, (VkImageLayout) TinyImageLayout::LAYOUT_GENERAL };
+			}
             
-			inline static VkWriteDescriptorSet GetWriteDescriptor(uint32_t binding, uint32_t descriptorCount, const VkDescriptorImageInfo* imageInfo) {
-				return { .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, .pImageInfo = imageInfo, .dstSet = 0, .dstBinding = binding, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = descriptorCount };
+			inline static VkWriteDescriptorSet GetWriteDescriptor(uint32_t binding, uint32_t descriptorCount, const VkDescriptorImageInfo* imageInfo, TinyDescriptorType descriptorType = TinyDescriptorType::TYPE_IMAGE_SAMPLER) {
+				return { .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, .pImageInfo = imageInfo, .dstSet = 0, .dstBinding = binding, .descriptorType = static_cast<VkDescriptorType>(descriptorType), .descriptorCount = descriptorCount };
 			}
 			
 			VkResult Initialize() {
@@ -239,7 +337,7 @@
 						return VK_ERROR_INITIALIZATION_FAILED;
                     return VK_SUCCESS;
 				} else {
-					return CreateImage(imageType, width, height, imageFormat, addressMode);
+					return CreateImage(imageType, width, height, imageFormat, addressMode, interpolation, mipLevels);
 				}
             }
 		};
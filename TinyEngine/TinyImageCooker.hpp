@@ -0,0 +1,304 @@
+#ifndef TINY_ENGINE_TINYIMAGECOOKER
+#define TINY_ENGINE_TINYIMAGECOOKER
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Offline image cooking: converts decoded RGBA8 pixels into GPU-ready KTX2 files (pre-swizzled RGBA8/BGRA8 or
+		///     block-compressed BC1/BC3, with generated mip chains). Cooked files load with TinyImageLoader::LoadImage as a plain
+		///     copy from the mapped file into staging memory (no decoding at runtime). See ./Tools/cooker.cpp and _COOKER.bat.
+		class TinyImageCooker {
+		private:
+			static void WriteLittleEndian(std::vector<uint8_t>& bytes, size_t offset, uint64_t value, size_t count) {
+				for(size_t i = 0; i < count; i++) bytes[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+			}
+
+			static uint16_t Pack565(const int32_t* rgb) {
+				return static_cast<uint16_t>(((rgb[0] * 31 + 127) / 255) << 11 | ((rgb[1] * 63 + 127) / 255) << 5 | ((rgb[2] * 31 + 127) / 255));
+			}
+
+			static void Unpack565(uint16_t color, int32_t* rgb) {
+				int32_t r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+				rgb[0] = (r << 3) | (r >> 2);
+				rgb[1] = (g << 2) | (g >> 4);
+				rgb[2] = (b << 3) | (b >> 2);
+			}
+
+			static float ToLinear(uint8_t value) {
+				float c = value / 255.0f;
+				return (c <= 0.04045f)? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+			}
+
+			static uint8_t ToSRGB(float value) {
+				float c = (value <= 0.0031308f)? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+				return static_cast<uint8_t>(std::clamp(c * 255.0f + 0.5f, 0.0f, 255.0f));
+			}
+
+			/// @brief Encodes a BC1 color block (16 RGBA texels) with inset bounding box endpoints, punchThrough maps alpha < 128 to transparent texels.
+			static void EncodeColorBlock(const uint8_t* texels, uint8_t* output, bool punchThrough) {
+				int32_t minColor[3] = { 255, 255, 255 }, maxColor[3] = { 0, 0, 0 };
+				bool transparent = false;
+
+				for(size_t i = 0; i < 16; i++) {
+					if (punchThrough && texels[i * 4 + 3] < 128) { transparent = true; continue; }
+					for(size_t c = 0; c < 3; c++) {
+						minColor[c] = std::min<int32_t>(minColor[c], texels[i * 4 + c]);
+						maxColor[c] = std::max<int32_t>(maxColor[c], texels[i * 4 + c]);
+					}
+				}
+
+				// Fully transparent block (no opaque texel set the bounds).
+				if (minColor[0] > maxColor[0]) {
+					memset(output, 0, 4);
+					memset(output + 4, 0xFF, 4);
+					return;
+				}
+
+				// Insetting the bounds by 1/16 of the range moves the endpoints off of outliers toward the interpolated colors.
+				for(size_t c = 0; c < 3; c++) {
+					int32_t inset = (maxColor[c] - minColor[c]) >> 4;
+					minColor[c] += inset;
+					maxColor[c] -= inset;
+				}
+
+				// color0 > color1 selects 4 colors, color0 <= color1 selects 3 colors and transparent black (index 3).
+				uint16_t color0 = Pack565(maxColor), color1 = Pack565(minColor);
+				if (transparent == (color0 > color1)) std::swap(color0, color1);
+
+				int32_t palette[4][3];
+				Unpack565(color0, palette[0]);
+				Unpack565(color1, palette[1]);
+				for(size_t c = 0; c < 3; c++) {
+					palette[2][c] = (color0 > color1)? (2 * palette[0][c] + palette[1][c]) / 3 : (palette[0][c] + palette[1][c]) / 2;
+					palette[3][c] = (color0 > color1)? (palette[0][c] + 2 * palette[1][c]) / 3 : 0;
+				}
+
+				uint32_t indices = 0, paletteCount = (color0 > color1)? 4 : 3;
+				for(uint32_t i = 0; i < 16; i++) {
+					uint32_t best = 3;
+					if (!punchThrough || texels[i * 4 + 3] >= 128) {
+						int32_t bestError = INT32_MAX;
+						for(uint32_t p = 0; p < paletteCount; p++) {
+							int32_t dr = palette[p][0] - texels[i * 4], dg = palette[p][1] - texels[i * 4 + 1], db = palette[p][2] - texels[i * 4 + 2];
+							int32_t error = dr * dr + dg * dg + db * db;
+							if (error < bestError) { bestError = error; best = p; }
+						}
+					}
+					indices |= best << (i * 2);
+				}
+
+				output[0] = static_cast<uint8_t>(color0);
+				output[1] = static_cast<uint8_t>(color0 >> 8);
+				output[2] = static_cast<uint8_t>(color1);
+				output[3] = static_cast<uint8_t>(color1 >> 8);
+				for(size_t i = 0; i < 4; i++) output[4 + i] = static_cast<uint8_t>(indices >> (i * 8));
+			}
+
+			/// @brief Encodes a BC3 (BC4 style) alpha block from 16 RGBA texels using the 8 interpolated alpha mode.
+			static void EncodeAlphaBlock(const uint8_t* texels, uint8_t* output) {
+				int32_t alpha0 = 0, alpha1 = 255;
+				for(size_t i = 0; i < 16; i++) {
+					alpha0 = std::max<int32_t>(alpha0, texels[i * 4 + 3]);
+					alpha1 = std::min<int32_t>(alpha1, texels[i * 4 + 3]);
+				}
+
+				output[0] = static_cast<uint8_t>(alpha0);
+				output[1] = static_cast<uint8_t>(alpha1);
+				memset(output + 2, 0, 6);
+				if (alpha0 == alpha1) return;
+
+				int32_t palette[8] = { alpha0, alpha1 };
+				for(int32_t i = 2; i < 8; i++) palette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7;
+
+				uint64_t indices = 0;
+				for(uint32_t i = 0; i < 16; i++) {
+					uint64_t best = 0;
+					int32_t bestError = INT32_MAX;
+					for(uint32_t p = 0; p < 8; p++) {
+						int32_t error = std::abs(palette[p] - texels[i * 4 + 3]);
+						if (error < bestError) { bestError = error; best = p; }
+					}
+					indices |= best << (i * 3);
+				}
+
+				for(size_t i = 0; i < 6; i++) output[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+			}
+
+			/// @brief Writes the KTX2 basic data format descriptor (color model, transfer function and channel samples) of a cookable format.
+			static void WriteDataFormatDescriptor(std::vector<uint8_t>& bytes, VkFormat format) {
+				TinyFormatBlock block = QueryFormatBlock(format);
+				bool srgb = QueryFormatSRGB(format);
+
+				// Samples: { bitOffset, bitLength - 1, channelType (id | qualifiers), sampleUpper }.
+				std::vector<std::array<uint32_t, 4>> samples;
+				uint8_t colorModel = 1; // KHR_DF_MODEL_RGBSDA
+				switch(format) {
+					case VK_FORMAT_BC1_RGB_UNORM_BLOCK: case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+						colorModel = 128; // KHR_DF_MODEL_BC1A
+						samples = { { 0, 63, 0, UINT32_MAX } };
+					break;
+					case VK_FORMAT_BC1_RGBA_UNORM_BLOCK: case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+						colorModel = 128;
+						samples = { { 0, 63, 1, UINT32_MAX } };
+					break;
+					case VK_FORMAT_BC3_UNORM_BLOCK: case VK_FORMAT_BC3_SRGB_BLOCK:
+						colorModel = 130; // KHR_DF_MODEL_BC3
+						samples = { { 0, 63, (srgb)? 0x1Fu : 0x0Fu, UINT32_MAX }, { 64, 63, 0, UINT32_MAX } };
+					break;
+					case VK_FORMAT_B8G8R8A8_UNORM: case VK_FORMAT_B8G8R8A8_SRGB:
+						samples = { { 0, 7, 2, 255 }, { 8, 7, 1, 255 }, { 16, 7, 0, 255 }, { 24, 7, (srgb)? 0x1Fu : 0x0Fu, 255 } };
+					break;
+					default:
+						samples = { { 0, 7, 0, 255 }, { 8, 7, 1, 255 }, { 16, 7, 2, 255 }, { 24, 7, (srgb)? 0x1Fu : 0x0Fu, 255 } };
+					break;
+				}
+
+				size_t offset = bytes.size(), blockSize = 24 + 16 * samples.size();
+				bytes.resize(offset + 4 + blockSize, 0);
+				WriteLittleEndian(bytes, offset, 4 + blockSize, 4);
+				WriteLittleEndian(bytes, offset + 4, 0, 4); // vendorId (Khronos), descriptorType (basic)
+				WriteLittleEndian(bytes, offset + 8, 2 | (blockSize << 16), 4); // versionNumber (1.3), descriptorBlockSize
+				bytes[offset + 12] = colorModel;
+				bytes[offset + 13] = 1; // KHR_DF_PRIMARIES_BT709
+				bytes[offset + 14] = (srgb)? 2 : 1; // KHR_DF_TRANSFER_SRGB / LINEAR
+				bytes[offset + 15] = 0; // KHR_DF_FLAG_ALPHA_STRAIGHT
+				bytes[offset + 16] = static_cast<uint8_t>(block.width - 1);
+				bytes[offset + 17] = static_cast<uint8_t>(block.height - 1);
+				bytes[offset + 20] = static_cast<uint8_t>(block.bytes);
+
+				for(size_t i = 0; i < samples.size(); i++) {
+					size_t sample = offset + 28 + i * 16;
+					WriteLittleEndian(bytes, sample, samples[i][0] | (samples[i][1] << 16) | (samples[i][2] << 24), 4);
+					WriteLittleEndian(bytes, sample + 12, samples[i][3], 4);
+				}
+			}
+
+		public:
+			/// @brief Returns true for the formats CookKTX2 can write: R8G8B8A8/B8G8R8A8 and BC1/BC3 (UNORM or SRGB).
+			static bool QueryCookableFormat(VkFormat format) {
+				switch(format) {
+					case VK_FORMAT_R8G8B8A8_UNORM: case VK_FORMAT_R8G8B8A8_SRGB: case VK_FORMAT_B8G8R8A8_UNORM: case VK_FORMAT_B8G8R8A8_SRGB:
+					case VK_FORMAT_BC1_RGB_UNORM_BLOCK: case VK_FORMAT_BC1_RGB_SRGB_BLOCK: case VK_FORMAT_BC1_RGBA_UNORM_BLOCK: case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+					case VK_FORMAT_BC3_UNORM_BLOCK: case VK_FORMAT_BC3_SRGB_BLOCK:
+						return true;
+					default:
+						return false;
+				}
+			}
+
+			/// @brief Returns true for the sRGB encoded cookable formats (mip levels are filtered in linear space).
+			static bool QueryFormatSRGB(VkFormat format) {
+				return format == VK_FORMAT_R8G8B8A8_SRGB || format == VK_FORMAT_B8G8R8A8_SRGB || format == VK_FORMAT_BC1_RGB_SRGB_BLOCK
+					|| format == VK_FORMAT_BC1_RGBA_SRGB_BLOCK || format == VK_FORMAT_BC3_SRGB_BLOCK;
+			}
+
+			/// @brief Downsamples RGBA8 pixels (width x height) to the next mip level with a 2x2 box filter (odd edges clamp), srgb filters color in linear space.
+			static void GenerateMipLevel(const uint8_t* pixels, uint32_t width, uint32_t height, uint8_t* output, bool srgb) {
+				uint32_t levelWidth = std::max<uint32_t>(1, width >> 1), levelHeight = std::max<uint32_t>(1, height >> 1);
+				for(uint32_t y = 0; y < levelHeight; y++) {
+					const uint8_t* row0 = pixels + static_cast<size_t>(std::min(y * 2, height - 1)) * width * 4;
+					const uint8_t* row1 = pixels + static_cast<size_t>(std::min(y * 2 + 1, height - 1)) * width * 4;
+
+					for(uint32_t x = 0; x < levelWidth; x++) {
+						size_t x0 = static_cast<size_t>(std::min(x * 2, width - 1)) * 4, x1 = static_cast<size_t>(std::min(x * 2 + 1, width - 1)) * 4;
+						uint8_t* target = output + (static_cast<size_t>(y) * levelWidth + x) * 4;
+
+						for(size_t c = 0; c < 4; c++) {
+							if (srgb && c < 3) {
+								target[c] = ToSRGB((ToLinear(row0[x0 + c]) + ToLinear(row0[x1 + c]) + ToLinear(row1[x0 + c]) + ToLinear(row1[x1 + c])) * 0.25f);
+							} else {
+								target[c] = static_cast<uint8_t>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4);
+							}
+						}
+					}
+				}
+			}
+
+			/// @brief Converts one RGBA8 mip level into a cookable format (output holds QueryFormatLevelSize bytes), block rows are encoded across the pool.
+			static void EncodeLevel(VkFormat format, const uint8_t* pixels, uint32_t width, uint32_t height, uint8_t* output, TinyThreadPool* pool = nullptr) {
+				TinyFormatBlock block = QueryFormatBlock(format);
+				uint32_t blocksX = (width + block.width - 1) / block.width, blocksY = (height + block.height - 1) / block.height;
+				bool swizzle = format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8A8_SRGB;
+				bool alphaBlock = format == VK_FORMAT_BC3_UNORM_BLOCK || format == VK_FORMAT_BC3_SRGB_BLOCK;
+				bool punchThrough = format == VK_FORMAT_BC1_RGBA_UNORM_BLOCK || format == VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+
+				auto encodeRow = [=](size_t by) {
+					uint8_t* target = output + by * blocksX * block.bytes;
+
+					if (!QueryFormatCompressed(format)) {
+						memcpy(target, pixels + by * width * 4, static_cast<size_t>(width) * 4);
+						if (swizzle) for(size_t x = 0; x < width; x++) std::swap(target[x * 4], target[x * 4 + 2]);
+						return;
+					}
+
+					uint8_t texels[64];
+					for(uint32_t bx = 0; bx < blocksX; bx++, target += block.bytes) {
+						// Edge blocks repeat the last row/column of texels.
+						for(uint32_t i = 0; i < 16; i++) {
+							size_t x = std::min<size_t>(bx * 4 + (i & 3), width - 1), y = std::min<size_t>(by * 4 + (i >> 2), height - 1);
+							memcpy(texels + i * 4, pixels + (y * width + x) * 4, 4);
+						}
+
+						if (alphaBlock) EncodeAlphaBlock(texels, target);
+						EncodeColorBlock(texels, target + ((alphaBlock)? 8 : 0), punchThrough);
+					}
+				};
+
+				if (pool != nullptr) {
+					pool->ParallelFor(blocksY, encodeRow);
+				} else {
+					for(size_t by = 0; by < blocksY; by++) encodeRow(by);
+				}
+			}
+
+			/// @brief Cooks RGBA8 pixels (width x height) into a KTX2 file of the format with mipLevels levels (0: full mip chain).
+			static VkResult CookKTX2(const uint8_t* pixels, uint32_t width, uint32_t height, VkFormat format, uint32_t mipLevels, std::vector<uint8_t>& bytes, TinyThreadPool* pool = nullptr) {
+				if (pixels == nullptr || width == 0 || height == 0 || !QueryCookableFormat(format)) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+
+				uint32_t levels = (mipLevels == 0)? QueryFullMipLevels(width, height) : std::min(mipLevels, QueryFullMipLevels(width, height));
+				TinyFormatBlock block = QueryFormatBlock(format);
+				const size_t headerSize = TinyImageLoader::ktx2HeaderSize, levelSize = TinyImageLoader::ktx2LevelSize;
+
+				bytes.assign(headerSize + levels * levelSize, 0);
+				memcpy(bytes.data(), TinyImageLoader::ktx2Identifier, sizeof(TinyImageLoader::ktx2Identifier));
+				WriteLittleEndian(bytes, 12, format, 4);
+				WriteLittleEndian(bytes, 16, 1, 4); // typeSize
+				WriteLittleEndian(bytes, 20, width, 4);
+				WriteLittleEndian(bytes, 24, height, 4);
+				WriteLittleEndian(bytes, 36, 1, 4); // faceCount
+				WriteLittleEndian(bytes, 40, levels, 4);
+
+				size_t dfdOffset = bytes.size();
+				WriteDataFormatDescriptor(bytes, format);
+				WriteLittleEndian(bytes, 48, dfdOffset, 4);
+				WriteLittleEndian(bytes, 52, bytes.size() - dfdOffset, 4);
+
+				// Levels are generated largest first but stored smallest first, each aligned to lcm(block bytes, 4).
+				std::vector<std::vector<uint8_t>> encoded(levels);
+				std::vector<uint8_t> level(pixels, pixels + static_cast<size_t>(width) * height * 4), nextLevel;
+
+				for(uint32_t l = 0; l < levels; l++) {
+					uint32_t levelWidth = std::max<uint32_t>(1, width >> l), levelHeight = std::max<uint32_t>(1, height >> l);
+					encoded[l].resize(static_cast<size_t>(QueryFormatLevelSize(format, levelWidth, levelHeight)));
+					EncodeLevel(format, level.data(), levelWidth, levelHeight, encoded[l].data(), pool);
+
+					if (l + 1 < levels) {
+						nextLevel.resize(static_cast<size_t>(std::max<uint32_t>(1, levelWidth >> 1)) * std::max<uint32_t>(1, levelHeight >> 1) * 4);
+						GenerateMipLevel(level.data(), levelWidth, levelHeight, nextLevel.data(), QueryFormatSRGB(format));
+						std::swap(level, nextLevel);
+					}
+				}
+
+				size_t alignment = std::max<size_t>(4, block.bytes);
+				for(uint32_t l = levels; l-- > 0;) {
+					bytes.resize((bytes.size() + alignment - 1) / alignment * alignment, 0);
+					WriteLittleEndian(bytes, headerSize + l * levelSize, bytes.size(), 8);
+					WriteLittleEndian(bytes, headerSize + l * levelSize + 8, encoded[l].size(), 8);
+					WriteLittleEndian(bytes, headerSize + l * levelSize + 16, encoded[l].size(), 8);
+					bytes.insert(bytes.end(), encoded[l].begin(), encoded[l].end());
+				}
+
+				return VK_SUCCESS;
+			}
+		};
+	}
+#endif
\ No newline at end of file
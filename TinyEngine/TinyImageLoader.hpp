@@ -0,0 +1,562 @@
+#ifndef TINY_ENGINE_TINYIMAGELOADER
+#define TINY_ENGINE_TINYIMAGELOADER
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Decoded image properties (channels/colorspace as stored in the source file).
+		///     format/mipLevels describe the staged image: VK_FORMAT_R8G8B8A8_UNORM (1 level) for decoded QOI/PNG, the stored format for KTX2.
+		struct TinyImageDescription {
+		public:
+			static constexpr VkDeviceSize levelAlignment = 16;
+
+			uint32_t width = 0, height = 0;
+			uint32_t channels = 0, colorspace = 0;
+			VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+			uint32_t mipLevels = 1;
+
+			/// @brief Returns the byte size of the decoded pixels with the requested output channels (0: source channels).
+			VkDeviceSize Sizeof(uint32_t outputChannels = 0) const {
+				return static_cast<VkDeviceSize>(width) * static_cast<VkDeviceSize>(height) * static_cast<VkDeviceSize>((outputChannels == 0)? channels : outputChannels);
+			}
+
+			/// @brief Returns the byte size of one staged mip level (block-size aware).
+			VkDeviceSize SizeofLevel(uint32_t level) const {
+				return QueryFormatLevelSize(format, std::max<VkDeviceSize>(1, width >> level), std::max<VkDeviceSize>(1, height >> level));
+			}
+
+			/// @brief Returns the byte size of all staged mip levels, each level starting levelAlignment aligned.
+			VkDeviceSize SizeofLevels() const {
+				VkDeviceSize size = 0;
+				for(uint32_t level = 0; level < mipLevels; level++) size = (size + levelAlignment - 1) / levelAlignment * levelAlignment + SizeofLevel(level);
+				return size;
+			}
+		};
+
+		/// @brief Decoder state at an op boundary of a QOI stream, decoding can restart (in parallel) from any restart point.
+		struct TinyQOIRestart {
+		public:
+			size_t byteOffset, pixelOffset;
+			uint32_t pixel;
+			std::array<uint32_t, 64> index;
+		};
+
+		/// @brief Image loader decoding memory mapped QOI (multi-threaded) and PNG (TINY_ENGINE_PNG) files straight into staging memory.
+		///
+		///     LoadImage decodes a TinyMappedFile into a sub-allocation of a persistently mapped staging buffer, the pixels are
+		///     written once (file pages -> staging memory) with no intermediate heap buffers, then copied to the image with
+		///     TinyRenderObject::CopyStagedToImage (or CopyStagedLevelsToImage for mip chains).
+		///
+		///     KTX2 files store GPU formats (BCn/ASTC, see QueryFormatBlock) which are copied as-is per mip level, create the
+		///     image with description.format and description.mipLevels. Supercompressed (BasisLZ/Zstandard/ZLIB) files are rejected.
+		///
+		///     QOI ops depend on the previous pixel and the 64-entry running index, so the stream can't be split blindly.
+		///     Images written by EncodeQOI carry sync points: every syncPixels pixels the encoder starts with an RGBA op and
+		///     only references index entries written since, the byte offset of each sync point is appended as a table after
+		///     the end marker (standard decoders stop at the last pixel and ignore it). Decoding restarts at every sync point.
+		///     Plain QOI files fall back to ScanQOI, which walks the ops once without writing pixels and records restart points.
+		///     DecodeQOI decodes each chunk on a TinyThreadPool straight into the output, e.g. a mapped staging buffer
+		///     (TinyBuffer::description.pMappedData), so no intermediate copy is made.
+		class TinyImageLoader {
+		public:
+			static constexpr size_t defaultChunkPixels = 65536;
+			/// @brief Pixels decoded into a cache resident buffer before conversion into the output (see TinyPixelConverter).
+			static constexpr size_t convertBatchPixels = 4096;
+			static constexpr size_t qoiHeaderSize = 14;
+			static constexpr size_t qoiPaddingSize = 8;
+			static constexpr uint32_t qoiMagic = 0x716f6966; // "qoif"
+			static constexpr uint32_t qoiPixelsMax = 400000000;
+			static constexpr VkDeviceSize stageAlignment = TinyImageDescription::levelAlignment;
+			static constexpr uint8_t ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+			static constexpr size_t ktx2HeaderSize = 80;
+			static constexpr size_t ktx2LevelSize = 24;
+			static constexpr uint8_t pngSignature[8] = { 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A };
+			static constexpr uint32_t qoiSyncMagic = 0x7173796e; // "qsyn"
+			static constexpr uint8_t qoiPadding[qoiPaddingSize] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+		private:
+			static uint32_t ReadBigEndian(const uint8_t* bytes) {
+				return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) | (static_cast<uint32_t>(bytes[2]) << 8) | static_cast<uint32_t>(bytes[3]);
+			}
+
+			static uint64_t ReadLittleEndian(const uint8_t* bytes, size_t count) {
+				uint64_t value = 0;
+				for(size_t i = 0; i < count; i++) value |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+				return value;
+			}
+
+			static void WriteBigEndian(std::vector<uint8_t>& bytes, uint32_t value) {
+				bytes.insert(bytes.end(), { static_cast<uint8_t>(value >> 24), static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value) });
+			}
+
+			/// Pixels are packed as r | g << 8 | b << 16 | a << 24 (RGBA byte order in memory on little-endian hosts).
+			static uint32_t Pack(uint32_t r, uint32_t g, uint32_t b, uint32_t a) { return (r & 0xFF) | ((g & 0xFF) << 8) | ((b & 0xFF) << 16) | (a << 24); }
+
+			static uint32_t Hash(uint32_t px) {
+				return ((px & 0xFF) * 3 + ((px >> 8) & 0xFF) * 5 + ((px >> 16) & 0xFF) * 7 + (px >> 24) * 11) & 63;
+			}
+
+			/// @brief Decodes the op at bytes[p] into px, returns the number of pixels the op produces (runs) and advances p.
+			static size_t DecodeOp(const uint8_t* bytes, size_t& p, uint32_t& px, std::array<uint32_t, 64>& index) {
+				uint32_t b1 = bytes[p++];
+				size_t count = 1;
+
+				if (b1 == 0xFE) {
+					px = Pack(bytes[p], bytes[p + 1], bytes[p + 2], px >> 24);
+					p += 3;
+				} else if (b1 == 0xFF) {
+					px = Pack(bytes[p], bytes[p + 1], bytes[p + 2], bytes[p + 3]);
+					p += 4;
+				} else switch(b1 & 0xC0) {
+					case 0x00: px = index[b1]; break;
+					case 0x40:
+						px = Pack((px & 0xFF) + ((b1 >> 4) & 0x03) - 2, ((px >> 8) & 0xFF) + ((b1 >> 2) & 0x03) - 2, ((px >> 16) & 0xFF) + (b1 & 0x03) - 2, px >> 24);
+					break;
+					case 0x80: {
+						uint32_t b2 = bytes[p++];
+						uint32_t vg = (b1 & 0x3F) - 32;
+						px = Pack((px & 0xFF) + vg - 8 + ((b2 >> 4) & 0x0F), ((px >> 8) & 0xFF) + vg, ((px >> 16) & 0xFF) + vg - 8 + (b2 & 0x0F), px >> 24);
+					} break;
+					default: count = (b1 & 0x3F) + 1; break;
+				}
+
+				index[Hash(px)] = px;
+				return count;
+			}
+
+		public:
+			/// @brief Reads and validates the QOI header, returns false if the data isn't a valid QOI image.
+			static bool ReadQOIHeader(const uint8_t* bytes, size_t size, TinyImageDescription& description) {
+				if (bytes == nullptr || size < qoiHeaderSize + qoiPaddingSize || ReadBigEndian(bytes) != qoiMagic) return false;
+				description.width = ReadBigEndian(bytes + 4);
+				description.height = ReadBigEndian(bytes + 8);
+				description.channels = bytes[12];
+				description.colorspace = bytes[13];
+				description.format = VK_FORMAT_R8G8B8A8_UNORM;
+				description.mipLevels = 1;
+
+				return description.width != 0 && description.height != 0 && description.channels >= 3 && description.channels <= 4
+					&& description.colorspace <= 1 && description.height < qoiPixelsMax / description.width;
+			}
+
+			/// @brief Reads the sync point table appended by EncodeQOI into restarts, returns the QOI stream size (size if there is no table).
+			static size_t ReadQOISyncTable(const uint8_t* bytes, size_t size, const TinyImageDescription& description, std::vector<TinyQOIRestart>& restarts) {
+				restarts.clear();
+				if (size < qoiHeaderSize + qoiPaddingSize + 12 || ReadBigEndian(bytes + size - 4) != qoiSyncMagic) return size;
+
+				const size_t pixelCount = static_cast<size_t>(description.width) * description.height;
+				const size_t syncPixels = ReadBigEndian(bytes + size - 12);
+				const size_t syncCount = ReadBigEndian(bytes + size - 8);
+				if (syncPixels == 0 || syncCount != (pixelCount - 1) / syncPixels || size < qoiHeaderSize + qoiPaddingSize + 12 + syncCount * 4) return size;
+
+				const size_t streamSize = size - 12 - syncCount * 4;
+				TinyQOIRestart state { .byteOffset = qoiHeaderSize, .pixelOffset = 0, .pixel = Pack(0, 0, 0, 255) };
+				state.index.fill(0);
+				restarts.push_back(state);
+
+				// Sync points start with an RGBA op and never read stale index entries, so the restart pixel/index are don't-cares.
+				for(size_t i = 0; i < syncCount; i++) {
+					state.byteOffset = ReadBigEndian(bytes + streamSize + i * 4);
+					state.pixelOffset = (i + 1) * syncPixels;
+					if (state.byteOffset <= restarts.back().byteOffset || state.byteOffset + 5 > streamSize - qoiPaddingSize || bytes[state.byteOffset] != 0xFF) {
+						restarts.clear();
+						return size;
+					}
+					restarts.push_back(state);
+				}
+
+				return streamSize;
+			}
+
+			/// @brief Walks the QOI ops (no pixel writes) recording a restart point at the first op boundary past every chunkPixels pixels.
+			static VkResult ScanQOI(const uint8_t* bytes, size_t size, std::vector<TinyQOIRestart>& restarts, size_t chunkPixels = defaultChunkPixels) {
+				TinyImageDescription description;
+				if (!ReadQOIHeader(bytes, size, description)) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+
+				TinyQOIRestart state { .byteOffset = qoiHeaderSize, .pixelOffset = 0, .pixel = Pack(0, 0, 0, 255) };
+				state.index.fill(0);
+
+				const size_t pixelCount = static_cast<size_t>(description.width) * description.height;
+				const size_t chunksLength = size - qoiPaddingSize;
+				chunkPixels = std::max<size_t>(1, chunkPixels);
+
+				restarts.clear();
+				restarts.reserve(pixelCount / chunkPixels + 1);
+				restarts.push_back(state);
+
+				for(size_t boundary = chunkPixels; state.pixelOffset < pixelCount && state.byteOffset < chunksLength;) {
+					state.pixelOffset += DecodeOp(bytes, state.byteOffset, state.pixel, state.index);
+					if (state.pixelOffset >= boundary && state.pixelOffset < pixelCount) {
+						restarts.push_back(state);
+						boundary = state.pixelOffset + chunkPixels;
+					}
+				}
+
+				return VK_SUCCESS;
+			}
+
+			/// @brief Decodes the pixels [restart.pixelOffset, pixelEnd) into output (the whole image, outputChannels 3 or 4).
+			///     With a converter pixels are decoded (4 channels) in batches and converted into output (converter->destBytes per pixel).
+			static void DecodeQOIChunk(const uint8_t* bytes, size_t size, const TinyQOIRestart& restart, size_t pixelEnd, uint8_t* output, uint32_t outputChannels, const TinyPixelConverter* converter = nullptr) {
+				const size_t chunksLength = size - qoiPaddingSize;
+				std::array<uint32_t, 64> index = restart.index;
+				uint32_t px = restart.pixel;
+				size_t p = restart.byteOffset, pending = 0;
+				std::array<uint8_t, convertBatchPixels * 4> batch;
+
+				for(size_t pixel = restart.pixelOffset; pixel < pixelEnd;) {
+					size_t batchStart = pixel, batchEnd = (converter == nullptr)? pixelEnd : std::min(pixel + convertBatchPixels, pixelEnd);
+					uint32_t channels = (converter == nullptr)? outputChannels : 4;
+					uint8_t* pixels = (converter == nullptr)? output + pixel * outputChannels : batch.data();
+
+					while(pixel < batchEnd) {
+						// Truncated streams repeat the last pixel (matches qoi_decode).
+						if (pending == 0) pending = (p < chunksLength)? DecodeOp(bytes, p, px, index) : pixelEnd - pixel;
+						size_t count = std::min(pending, batchEnd - pixel);
+
+						if (channels == 4) {
+							for(size_t i = 0; i < count; i++, pixels += 4) memcpy(pixels, &px, 4);
+						} else {
+							for(size_t i = 0; i < count; i++, pixels += 3) memcpy(pixels, &px, 3);
+						}
+
+						pixel += count;
+						pending -= count;
+					}
+
+					if (converter != nullptr) converter->Convert(batch.data(), output + batchStart * converter->destBytes, batchEnd - batchStart);
+				}
+			}
+
+			/// @brief Decodes a QOI image into output (outputSize >= description.Sizeof(outputChannels)), outputChannels 3 or 4.
+			///     Chunks (sync points or ScanQOI restarts) are decoded on the thread pool and the calling thread, or serially if pool is nullptr.
+			///     A converter (from 4 channel pixels) converts each decoded batch into output instead (converter->destBytes per pixel).
+			static VkResult DecodeQOI(const uint8_t* bytes, size_t size, TinyImageDescription& description, void* output, VkDeviceSize outputSize,
+			uint32_t outputChannels = 4, TinyThreadPool* pool = nullptr, size_t chunkPixels = defaultChunkPixels, const TinyPixelConverter* converter = nullptr) {
+				if (!ReadQOIHeader(bytes, size, description)) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				if (converter != nullptr && converter->Identity()) converter = nullptr;
+				if (converter != nullptr && !converter->Supported()) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				if (converter != nullptr) outputChannels = 4;
+				if (output == nullptr || (outputChannels != 3 && outputChannels != 4) || outputSize < description.Sizeof((converter != nullptr)? converter->destBytes : outputChannels)) return VK_ERROR_OUT_OF_HOST_MEMORY;
+
+				const size_t pixelCount = static_cast<size_t>(description.width) * description.height;
+				uint8_t* pixels = static_cast<uint8_t*>(output);
+
+				std::vector<TinyQOIRestart> restarts;
+				size = ReadQOISyncTable(bytes, size, description, restarts);
+				if (restarts.size() == 0) {
+					TinyQOIRestart start { .byteOffset = qoiHeaderSize, .pixelOffset = 0, .pixel = Pack(0, 0, 0, 255) };
+					start.index.fill(0);
+
+					if (pool == nullptr || pool->WorkerCount() == 0) {
+						DecodeQOIChunk(bytes, size, start, pixelCount, pixels, outputChannels, converter);
+						return VK_SUCCESS;
+					}
+
+					VkResult result = ScanQOI(bytes, size, restarts, chunkPixels);
+					if (result != VK_SUCCESS) return result;
+				}
+
+				if (pool == nullptr) {
+					for(size_t chunk = 0; chunk < restarts.size(); chunk++)
+						DecodeQOIChunk(bytes, size, restarts[chunk], (chunk + 1 < restarts.size())? restarts[chunk + 1].pixelOffset : pixelCount, pixels, outputChannels, converter);
+					return VK_SUCCESS;
+				}
+
+				pool->ParallelFor(restarts.size(), [&](size_t chunk) {
+					size_t pixelEnd = (chunk + 1 < restarts.size())? restarts[chunk + 1].pixelOffset : pixelCount;
+					DecodeQOIChunk(bytes, size, restarts[chunk], pixelEnd, pixels, outputChannels, converter);
+				});
+
+				return VK_SUCCESS;
+			}
+
+			/// @brief Encodes pixels (description.channels 3 or 4) as QOI with a sync point every syncPixels pixels (0: plain QOI).
+			///     The output remains a valid QOI stream, sync points only restrict which ops the encoder may choose.
+			static VkResult EncodeQOI(const uint8_t* pixels, const TinyImageDescription& description, std::vector<uint8_t>& bytes, size_t syncPixels = defaultChunkPixels) {
+				if (pixels == nullptr || description.width == 0 || description.height == 0 || description.channels < 3 || description.channels > 4
+					|| description.colorspace > 1 || description.height >= qoiPixelsMax / description.width) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+
+				const size_t pixelCount = static_cast<size_t>(description.width) * description.height;
+				const uint32_t channels = description.channels;
+				bytes.clear();
+				bytes.reserve(qoiHeaderSize + pixelCount * (channels + 1) / 2 + qoiPaddingSize);
+				WriteBigEndian(bytes, qoiMagic);
+				WriteBigEndian(bytes, description.width);
+				WriteBigEndian(bytes, description.height);
+				bytes.push_back(static_cast<uint8_t>(channels));
+				bytes.push_back(static_cast<uint8_t>(description.colorspace));
+
+				std::array<uint32_t, 64> index;
+				index.fill(0);
+				uint64_t indexValid = ~0ULL;
+				uint32_t previous = Pack(0, 0, 0, 255);
+				uint32_t run = 0;
+				std::vector<uint32_t> syncOffsets;
+
+				for(size_t pixel = 0; pixel < pixelCount; pixel++) {
+					const uint8_t* source = pixels + pixel * channels;
+					uint32_t px = Pack(source[0], source[1], source[2], (channels == 4)? source[3] : 255);
+					bool sync = syncPixels > 0 && pixel > 0 && pixel % syncPixels == 0;
+
+					if (px == previous && !sync) {
+						if (++run == 62 || pixel + 1 == pixelCount) { bytes.push_back(static_cast<uint8_t>(0xC0 | (run - 1))); run = 0; }
+						continue;
+					}
+
+					if (run > 0) { bytes.push_back(static_cast<uint8_t>(0xC0 | (run - 1))); run = 0; }
+
+					uint32_t hash = Hash(px);
+					if (sync) {
+						// Restart point: the decoder can start here without the previous pixel or index (only entries written from here are valid).
+						syncOffsets.push_back(static_cast<uint32_t>(bytes.size()));
+						indexValid = 0;
+						bytes.insert(bytes.end(), { 0xFF, source[0], source[1], source[2], static_cast<uint8_t>(px >> 24) });
+					} else if ((indexValid & (1ULL << hash)) && index[hash] == px) {
+						bytes.push_back(static_cast<uint8_t>(hash));
+					} else if ((px >> 24) == (previous >> 24)) {
+						int32_t vr = static_cast<int8_t>((px & 0xFF) - (previous & 0xFF));
+						int32_t vg = static_cast<int8_t>(((px >> 8) & 0xFF) - ((previous >> 8) & 0xFF));
+						int32_t vb = static_cast<int8_t>(((px >> 16) & 0xFF) - ((previous >> 16) & 0xFF));
+						int32_t vgr = vr - vg, vgb = vb - vg;
+
+						if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+							bytes.push_back(static_cast<uint8_t>(0x40 | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+						} else if (vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8) {
+							bytes.insert(bytes.end(), { static_cast<uint8_t>(0x80 | (vg + 32)), static_cast<uint8_t>((vgr + 8) << 4 | (vgb + 8)) });
+						} else {
+							bytes.insert(bytes.end(), { 0xFE, source[0], source[1], source[2] });
+						}
+					} else {
+						bytes.insert(bytes.end(), { 0xFF, source[0], source[1], source[2], static_cast<uint8_t>(px >> 24) });
+					}
+
+					index[hash] = px;
+					indexValid |= 1ULL << hash;
+					previous = px;
+				}
+
+				bytes.insert(bytes.end(), qoiPadding, qoiPadding + qoiPaddingSize);
+				if (syncOffsets.size() > 0 && bytes.size() <= UINT32_MAX) {
+					for(uint32_t offset : syncOffsets) WriteBigEndian(bytes, offset);
+					WriteBigEndian(bytes, static_cast<uint32_t>(syncPixels));
+					WriteBigEndian(bytes, static_cast<uint32_t>(syncOffsets.size()));
+					WriteBigEndian(bytes, qoiSyncMagic);
+				}
+
+				return VK_SUCCESS;
+			}
+
+			#if TINY_ENGINE_PNG
+			/// @brief Reads the PNG header (IHDR), channels is 4 for images with alpha (or transparency) otherwise 3.
+			static bool ReadPNGHeader(const uint8_t* bytes, size_t size, TinyImageDescription& description) {
+				spng_ctx* context = spng_ctx_new(0);
+				if (context == nullptr) return false;
+
+				spng_ihdr header;
+				spng_trns transparency;
+				bool valid = spng_set_png_buffer(context, bytes, size) == 0 && spng_get_ihdr(context, &header) == 0;
+				if (valid) {
+					description.width = header.width;
+					description.height = header.height;
+					description.channels = (header.color_type == SPNG_COLOR_TYPE_TRUECOLOR_ALPHA || header.color_type == SPNG_COLOR_TYPE_GRAYSCALE_ALPHA
+						|| spng_get_trns(context, &transparency) == 0)? 4 : 3;
+					description.colorspace = 0;
+					description.format = VK_FORMAT_R8G8B8A8_UNORM;
+					description.mipLevels = 1;
+				}
+
+				spng_ctx_free(context);
+				return valid;
+			}
+
+			/// @brief Decodes a PNG image into output (outputSize >= description.Sizeof(outputChannels)), outputChannels 3 or 4 (8-bit).
+			///     A converter (from 4 channel pixels) converts the decoded image into output instead (converter->destBytes per pixel).
+			static VkResult DecodePNG(const uint8_t* bytes, size_t size, TinyImageDescription& description, void* output, VkDeviceSize outputSize, uint32_t outputChannels = 4, const TinyPixelConverter* converter = nullptr, TinyThreadPool* pool = nullptr) {
+				if (!ReadPNGHeader(bytes, size, description)) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				if (converter != nullptr && !converter->Identity()) {
+					if (!converter->Supported()) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+					if (output == nullptr || outputSize < description.Sizeof(converter->destBytes)) return VK_ERROR_OUT_OF_HOST_MEMORY;
+
+					// libspng decodes whole images, the pixels are converted from an intermediate buffer.
+					std::vector<uint8_t> pixels(static_cast<size_t>(description.Sizeof(4)));
+					VkResult result = DecodePNG(bytes, size, description, pixels.data(), pixels.size(), 4);
+					if (result == VK_SUCCESS) converter->Convert(pixels.data(), output, static_cast<size_t>(description.width) * description.height, pool);
+					return result;
+				}
+
+				if (output == nullptr || (outputChannels != 3 && outputChannels != 4) || outputSize < description.Sizeof(outputChannels)) return VK_ERROR_OUT_OF_HOST_MEMORY;
+
+				spng_ctx* context = spng_ctx_new(0);
+				if (context == nullptr) return VK_ERROR_OUT_OF_HOST_MEMORY;
+
+				int format = (outputChannels == 4)? SPNG_FMT_RGBA8 : SPNG_FMT_RGB8;
+				size_t decodedSize = 0;
+				int error = spng_set_png_buffer(context, bytes, size);
+				if (error == 0) error = spng_decoded_image_size(context, format, &decodedSize);
+				if (error == 0) error = (decodedSize <= outputSize)? spng_decode_image(context, output, decodedSize, format, SPNG_DECODE_TRNS) : SPNG_EOVERFLOW;
+				spng_ctx_free(context);
+
+				#if TINY_ENGINE_VALIDATION
+					if (error != 0) std::cout << "TinyEngine: PNG decode failed: " << spng_strerror(error) << std::endl;
+				#endif
+
+				return (error == 0)? VK_SUCCESS : VK_ERROR_FORMAT_NOT_SUPPORTED;
+			}
+			#endif
+
+			/// @brief Reads and validates a KTX2 header (2D, single layer/face, no supercompression, format known to QueryFormatBlock).
+			static bool ReadKTX2Header(const uint8_t* bytes, size_t size, TinyImageDescription& description) {
+				if (bytes == nullptr || size < ktx2HeaderSize || memcmp(bytes, ktx2Identifier, sizeof(ktx2Identifier)) != 0) return false;
+
+				VkFormat format = static_cast<VkFormat>(ReadLittleEndian(bytes + 12, 4));
+				uint32_t width = static_cast<uint32_t>(ReadLittleEndian(bytes + 20, 4)), height = static_cast<uint32_t>(ReadLittleEndian(bytes + 24, 4));
+				uint32_t depth = static_cast<uint32_t>(ReadLittleEndian(bytes + 28, 4)), layers = static_cast<uint32_t>(ReadLittleEndian(bytes + 32, 4));
+				uint32_t faces = static_cast<uint32_t>(ReadLittleEndian(bytes + 36, 4)), levels = std::max<uint32_t>(1, static_cast<uint32_t>(ReadLittleEndian(bytes + 40, 4)));
+				uint32_t supercompression = static_cast<uint32_t>(ReadLittleEndian(bytes + 44, 4));
+
+				if (supercompression != 0) {
+					#if TINY_ENGINE_VALIDATION
+						std::cout << "TinyEngine: KTX2 supercompression (BasisLZ/Zstandard/ZLIB) is not supported" << std::endl;
+					#endif
+					return false;
+				}
+
+				if (format == VK_FORMAT_UNDEFINED || QueryFormatBlock(format).bytes == 0 || width == 0 || height == 0 || depth > 1 || layers > 1 || faces != 1
+					|| levels > QueryFullMipLevels(width, height) || size < ktx2HeaderSize + levels * ktx2LevelSize) return false;
+
+				description.width = width;
+				description.height = height;
+				description.channels = 4;
+				description.colorspace = 0;
+				description.format = format;
+				description.mipLevels = levels;
+
+				for(uint32_t level = 0; level < levels; level++) {
+					uint64_t byteOffset = ReadLittleEndian(bytes + ktx2HeaderSize + level * ktx2LevelSize, 8);
+					uint64_t byteLength = ReadLittleEndian(bytes + ktx2HeaderSize + level * ktx2LevelSize + 8, 8);
+					if (byteLength < description.SizeofLevel(level) || byteOffset > size || byteLength > size - byteOffset) return false;
+				}
+
+				return true;
+			}
+
+			/// @brief Copies every mip level of a KTX2 file into output (outputSize >= description.SizeofLevels()), levelOffsets receives each level's offset into output.
+			static VkResult DecodeKTX2(const uint8_t* bytes, size_t size, TinyImageDescription& description, void* output, VkDeviceSize outputSize, std::vector<VkDeviceSize>& levelOffsets) {
+				if (!ReadKTX2Header(bytes, size, description)) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				if (output == nullptr || outputSize < description.SizeofLevels()) return VK_ERROR_OUT_OF_HOST_MEMORY;
+
+				levelOffsets.clear();
+				VkDeviceSize offset = 0;
+				for(uint32_t level = 0; level < description.mipLevels; level++) {
+					offset = (offset + stageAlignment - 1) & ~(stageAlignment - 1);
+					uint64_t byteOffset = ReadLittleEndian(bytes + ktx2HeaderSize + level * ktx2LevelSize, 8);
+					memcpy(static_cast<int8_t*>(output) + offset, bytes + byteOffset, static_cast<size_t>(description.SizeofLevel(level)));
+					levelOffsets.push_back(offset);
+					offset += description.SizeofLevel(level);
+				}
+
+				return VK_SUCCESS;
+			}
+
+			/// @brief Returns the image file format from its signature (PNG is only reported if TINY_ENGINE_PNG is enabled).
+			static TinyImageFileFormat QueryFileFormat(const uint8_t* bytes, size_t size) {
+				if (bytes != nullptr && size >= 4 && ReadBigEndian(bytes) == qoiMagic) return TinyImageFileFormat::FORMAT_QOI;
+				if (bytes != nullptr && size >= sizeof(ktx2Identifier) && memcmp(bytes, ktx2Identifier, sizeof(ktx2Identifier)) == 0) return TinyImageFileFormat::FORMAT_KTX2;
+
+				#if TINY_ENGINE_PNG
+					if (bytes != nullptr && size >= sizeof(pngSignature) && memcmp(bytes, pngSignature, sizeof(pngSignature)) == 0) return TinyImageFileFormat::FORMAT_PNG;
+				#endif
+
+				return TinyImageFileFormat::FORMAT_UNKNOWN;
+			}
+
+			/// @brief Reads the image header of any supported file format.
+			static bool ReadHeader(const uint8_t* bytes, size_t size, TinyImageDescription& description) {
+				switch(QueryFileFormat(bytes, size)) {
+					case TinyImageFileFormat::FORMAT_QOI: return ReadQOIHeader(bytes, size, description);
+					case TinyImageFileFormat::FORMAT_KTX2: return ReadKTX2Header(bytes, size, description);
+					#if TINY_ENGINE_PNG
+						case TinyImageFileFormat::FORMAT_PNG: return ReadPNGHeader(bytes, size, description);
+					#endif
+					default: return false;
+				}
+			}
+
+			/// @brief Returns the converter from decoded QOI/PNG pixels to imageFormat (VK_FORMAT_UNDEFINED keeps R8G8B8A8_UNORM), KTX2 files aren't converted.
+			///     Decoded colors keep their encoding: sRGB images receive the (sRGB) colors as stored, only swizzle/expansion/premultiply apply.
+			static TinyPixelConverter QueryConverter(TinyImageFileFormat fileFormat, VkFormat imageFormat, bool premultiply = false) {
+				if (fileFormat == TinyImageFileFormat::FORMAT_KTX2) return TinyPixelConverter();
+				if (imageFormat == VK_FORMAT_UNDEFINED) imageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+				bool srgb = imageFormat == VK_FORMAT_R8G8B8A8_SRGB || imageFormat == VK_FORMAT_B8G8R8A8_SRGB;
+				return TinyPixelConverter((srgb)? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM, imageFormat, premultiply);
+			}
+
+			/// @brief Decodes an image of any supported file format into output (the thread pool is only used for QOI).
+			///     KTX2 data is copied as stored (outputChannels and converter are ignored), use DecodeLevels for the mip level offsets.
+			static VkResult Decode(const uint8_t* bytes, size_t size, TinyImageDescription& description, void* output, VkDeviceSize outputSize, uint32_t outputChannels = 4, TinyThreadPool* pool = nullptr, const TinyPixelConverter* converter = nullptr) {
+				std::vector<VkDeviceSize> levelOffsets;
+				switch(QueryFileFormat(bytes, size)) {
+					case TinyImageFileFormat::FORMAT_QOI: return DecodeQOI(bytes, size, description, output, outputSize, outputChannels, pool, defaultChunkPixels, converter);
+					case TinyImageFileFormat::FORMAT_KTX2: return DecodeKTX2(bytes, size, description, output, outputSize, levelOffsets);
+					#if TINY_ENGINE_PNG
+						case TinyImageFileFormat::FORMAT_PNG: return DecodePNG(bytes, size, description, output, outputSize, outputChannels, converter, pool);
+					#endif
+					default: return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				}
+			}
+
+			/// @brief Decodes (QOI/PNG: 4 channels) or copies (KTX2: every mip level) an image into output (outputSize >= description.SizeofLevels()),
+			///     levelOffsets receives each mip level's offset into output. QOI/PNG pixels are converted by the converter (see QueryConverter)
+			///     while they're written, description.format is then the converter's destination format.
+			static VkResult DecodeLevels(const uint8_t* bytes, size_t size, TinyImageDescription& description, void* output, VkDeviceSize outputSize, std::vector<VkDeviceSize>& levelOffsets, TinyThreadPool* pool = nullptr, const TinyPixelConverter* converter = nullptr) {
+				if (QueryFileFormat(bytes, size) == TinyImageFileFormat::FORMAT_KTX2) return DecodeKTX2(bytes, size, description, output, outputSize, levelOffsets);
+
+				levelOffsets.assign(1, 0);
+				VkResult result = Decode(bytes, size, description, output, outputSize, 4, pool, converter);
+				if (result == VK_SUCCESS && converter != nullptr) description.format = converter->destFormat;
+				return result;
+			}
+
+			/// @brief Returns the staging bytes LoadImage needs for the image (all levels, including worst case alignment padding),
+			///     imageFormat is the format decoded (R8G8B8A8_UNORM) pixels are converted to.
+			static VkDeviceSize SizeofStaged(TinyImageDescription description, VkFormat imageFormat = VK_FORMAT_UNDEFINED) {
+				if (imageFormat != VK_FORMAT_UNDEFINED && description.format == VK_FORMAT_R8G8B8A8_UNORM) description.format = imageFormat;
+				return description.SizeofLevels() + stageAlignment - 1;
+			}
+
+			/// @brief Decodes the mapped image file (all mip levels) into the persistently mapped staging buffer at the next aligned offset.
+			///     levelOffsets receives the staging offset of each mip level (for CopyStagedLevelsToImage), stageOffset is advanced past them.
+			///     QOI/PNG pixels are converted to imageFormat (e.g. the destination image's format, see QueryConverter) while staged.
+			static VkResult LoadImage(const TinyMappedFile& file, TinyBuffer& stageBuffer, VkDeviceSize& stageOffset, TinyImageDescription& description, std::vector<VkDeviceSize>& levelOffsets, TinyThreadPool* pool = nullptr,
+			VkFormat imageFormat = VK_FORMAT_UNDEFINED, bool premultiply = false) {
+				if (file.data == nullptr || !ReadHeader(file.data, file.size, description)) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				if (stageBuffer.description.pMappedData == nullptr) return VK_ERROR_MEMORY_MAP_FAILED;
+
+				TinyPixelConverter converter = QueryConverter(QueryFileFormat(file.data, file.size), imageFormat, premultiply);
+				if (!converter.Supported()) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+				if (!converter.Identity()) description.format = converter.destFormat;
+
+				VkDeviceSize alignedOffset = (stageOffset + stageAlignment - 1) & ~(stageAlignment - 1);
+				VkDeviceSize byteSize = description.SizeofLevels();
+				if (alignedOffset + byteSize > stageBuffer.size) return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+
+				VkResult result = DecodeLevels(file.data, file.size, description, static_cast<int8_t*>(stageBuffer.description.pMappedData) + alignedOffset, byteSize, levelOffsets, pool, (converter.Identity())? nullptr : &converter);
+				if (result != VK_SUCCESS) return result;
+
+				for(VkDeviceSize& levelOffset : levelOffsets) levelOffset += alignedOffset;
+				stageOffset = alignedOffset + byteSize;
+				return VK_SUCCESS;
+			}
+
+			/// @brief Decodes the mapped image file (first mip level only for KTX2) into the staging buffer at the next aligned offset.
+			///     imageOffset receives the offset of the pixels (for CopyStagedToImage), stageOffset is advanced past them.
+			static VkResult LoadImage(const TinyMappedFile& file, TinyBuffer& stageBuffer, VkDeviceSize& stageOffset, TinyImageDescription& description, VkDeviceSize& imageOffset, TinyThreadPool* pool = nullptr,
+			VkFormat imageFormat = VK_FORMAT_UNDEFINED, bool premultiply = false) {
+				std::vector<VkDeviceSize> levelOffsets;
+				VkResult result = LoadImage(file, stageBuffer, stageOffset, description, levelOffsets, pool, imageFormat, premultiply);
+				if (result == VK_SUCCESS) imageOffset = levelOffsets[0];
+				return result;
+			}
+		};
+	}
+#endif
\ No newline at end of file
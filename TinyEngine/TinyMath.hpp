@@ -90,6 +90,7 @@
             TinyQuad& VertexColor(size_t index, glm::vec4 vcolor) { vertices[index].color = vcolor; return (*this); }
             TinyQuad& VerticesColor(glm::vec4 vcolor) { for(size_t i = 0; i < 6; i++) vertices[i].color = vcolor; return (*this); }
             size_t SizeofQuad() { return sizeof(TinyVertex) * 6ULL; }
+            size_t SizeofIndexedQuad() { return sizeof(TinyVertex) * 4ULL; }
 
             const static std::vector<TinyVertex> GetVertexVector(std::vector<std::array<TinyVertex, 6>> quads) {
                 std::vector<TinyVertex> vertices;
@@ -97,6 +98,30 @@
                     vertices.insert(vertices.end(), quad.begin(), quad.end());
                 return vertices;
             }
+
+            const static std::vector<TinyVertex> GetIndexedVertexVector(std::vector<std::array<TinyVertex, 4>> quads) {
+                std::vector<TinyVertex> vertices;
+                vertices.reserve(quads.size() * 4ULL);
+                for(std::array<TinyVertex, 4> quad : quads)
+                    vertices.insert(vertices.end(), quad.begin(), quad.end());
+                return vertices;
+            }
+
+            /// @brief Index list for quadCount 4-vertex quads: (0, 1, 2) (1, 3, 2) per quad, same winding as Vertices().
+            template<typename T = uint32_t>
+            const static std::vector<T> GetIndexVector(size_t quadCount) {
+                std::vector<T> indices(quadCount * 6ULL);
+                for(size_t i = 0; i < quadCount; i++) {
+                    T corner = static_cast<T>(i * 4ULL);
+                    indices[i * 6ULL + 0] = corner + 0;
+                    indices[i * 6ULL + 1] = corner + 1;
+                    indices[i * 6ULL + 2] = corner + 2;
+                    indices[i * 6ULL + 3] = corner + 1;
+                    indices[i * 6ULL + 4] = corner + 3;
+                    indices[i * 6ULL + 5] = corner + 2;
+                }
+                return indices;
+            }
             
             glm::vec4 GetAtlasUVs(glm::vec2 xy, glm::vec2 wh, glm::vec2 atlas) {
                 glm::vec2 uv1, uv2;
@@ -133,6 +158,12 @@
 
                 return vertices;
             }
+
+            /// @brief 4-vertex (indexed) form of Vertices(), corners: [xy1, (x2,y1), (x1,y2), xy2], draw with GetIndexVector() indices.
+            std::array<TinyVertex, 4> IndexedVertices() {
+                std::array<TinyVertex, 6>& quad = Vertices();
+                return { quad[0], quad[1], quad[2], quad[4] };
+            }
         };
     }
 #endif
\ No newline at end of file
@@ -64,6 +64,7 @@
 			VkPrimitiveTopology vertexTopology;
 			VkPolygonMode polygonTopology;
 			TinyVertexDescription vertexDescription;
+			VkDescriptorSetLayout bindlessLayout = VK_NULL_HANDLE;
 
 			static TinyPipelineCreateInfo GraphicsInfo(TinyShader vertex, TinyShader fragment, bool blending = true, bool interpolation = false, bool clearOnLoad = true, VkFormat imageFormat = VK_FORMAT_B8G8R8A8_UNORM, VkSamplerAddressMode addressMode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE, VkPrimitiveTopology vertexTopology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VkPolygonMode polygonTopology = VK_POLYGON_MODE_FILL, TinyVertexDescription vertexDescription = TinyVertex::GetVertexDescription()) {
 				return { {vertex, fragment}, TinyPipelineType::TYPE_GRAPHICS, blending, interpolation, clearOnLoad, imageFormat, addressMode, vertexTopology, polygonTopology, vertexDescription };
@@ -76,6 +77,12 @@
 			static TinyPipelineCreateInfo TransferInfo() {
 				return { {}, TinyPipelineType::TYPE_TRANSFER, true, false, false, VK_FORMAT_B8G8R8A8_UNORM, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_POLYGON_MODE_FILL, TinyVertex::GetVertexDescription() };
 			}
+
+			/// @brief Creates the pipeline layout with a bindless image set (TinyBindlessSet::descriptorLayout) at descriptor set 1.
+			TinyPipelineCreateInfo& BindlessInfo(VkDescriptorSetLayout bindlessLayout) {
+				this->bindlessLayout = bindlessLayout;
+				return (*this);
+			}
 		};
 
 		class TinyPipeline : public TinyDisposable {
@@ -93,10 +100,16 @@
 			~TinyPipeline() { this->Dispose(); }
 			
 			void Disposable(bool waitIdle) {
-				if (waitIdle) { vkQueueWaitIdle(submitQueue); vkDeviceWaitIdle(vkdevice.logicalDevice); }
-				if (descriptorLayout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(vkdevice.logicalDevice, descriptorLayout, VK_NULL_HANDLE);
-				if (pipeline != VK_NULL_HANDLE) vkDestroyPipeline(vkdevice.logicalDevice, pipeline, VK_NULL_HANDLE);
-				if (layout != VK_NULL_HANDLE) vkDestroyPipelineLayout(vkdevice.logicalDevice, layout, VK_NULL_HANDLE);
+				VkDevice device = vkdevice.logicalDevice;
+				VkDescriptorSetLayout descriptorLayout = this->descriptorLayout;
+				VkPipeline pipeline = this->pipeline;
+				VkPipelineLayout layout = this->layout;
+
+				vkdevice.deletionQueue.Push([device, descriptorLayout, pipeline, layout]() {
+					if (descriptorLayout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(device, descriptorLayout, VK_NULL_HANDLE);
+					if (pipeline != VK_NULL_HANDLE) vkDestroyPipeline(device, pipeline, VK_NULL_HANDLE);
+					if (layout != VK_NULL_HANDLE) vkDestroyPipelineLayout(device, layout, VK_NULL_HANDLE);
+				}, waitIdle);
 			}
 
 			TinyPipeline(TinyVkDevice& vkdevice, TinyPipelineCreateInfo createInfo)
@@ -161,8 +174,8 @@
 					} else { result = VK_ERROR_INVALID_SHADER_NV; break; }
 				}
 				
+				std::vector<VkPushConstantRange> pconstants;
 				if (result == VK_SUCCESS) {
-					std::vector<VkPushConstantRange> pconstants;
 					for(TinyShader shader : createInfo.shaders)
 						for(uint32_t range : shader.pconstants)
 							pconstants.push_back(TinyPipeline::GetPushConstantRange(shader.stage, range));
@@ -173,8 +186,11 @@
 							pdescriptors.push_back(TinyPipeline::GetPushDescriptorLayoutBinding(shader.stage, static_cast<uint32_t>(type.second), type.first, 1));
 					
 					VkDescriptorSetLayoutCreateInfo descriptorCreateInfo { .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR, .pBindings = pdescriptors.data(), .bindingCount = static_cast<uint32_t>(pdescriptors.size()) };
+					// Set 0 is always created (empty if no push descriptors), so the bindless set keeps its index 1 in the pipeline layout.
 					result = vkCreateDescriptorSetLayout(vkdevice.logicalDevice, &descriptorCreateInfo, VK_NULL_HANDLE, &descriptorLayout);
+				}
 
+				if (result == VK_SUCCESS) {
 					VkPipelineVertexInputStateCreateInfo vertexInputInfo = defaultVertexInputInfo;
 						vertexInputInfo.vertexBindingDescriptionCount = 1;
 						vertexInputInfo.pVertexBindingDescriptions = &createInfo.vertexDescription.binding;
@@ -191,11 +207,14 @@
 					VkPipelineRenderingCreateInfoKHR renderingCreateInfo = defaultRenderingCreateInfo;
 						renderingCreateInfo.pColorAttachmentFormats = &createInfo.imageFormat;
 					
+					VkDescriptorSetLayout setLayouts[] = { descriptorLayout, createInfo.bindlessLayout };
+					uint32_t setLayoutCount = (createInfo.bindlessLayout != VK_NULL_HANDLE)? 2U : 1U;
+					
 					VkPipelineLayoutCreateInfo pipelineLayoutInfo {
 						.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
 						.pushConstantRangeCount = static_cast<uint32_t>(pconstants.size()),
 						.pPushConstantRanges = pconstants.data(),
-						.setLayoutCount = (descriptorLayout != VK_NULL_HANDLE)? 1U : 0U, .pSetLayouts = &descriptorLayout
+						.setLayoutCount = setLayoutCount, .pSetLayouts = setLayouts
 					};
 					result = vkCreatePipelineLayout(vkdevice.logicalDevice, &pipelineLayoutInfo, VK_NULL_HANDLE, &layout);
 					
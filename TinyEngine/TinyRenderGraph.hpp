@@ -5,24 +5,69 @@
 	namespace TINY_ENGINE_NAMESPACE {
 		using TinyRenderEvent = TinyCallback<TinyRenderPass&, TinyRenderObject&, bool>;
 
+		/// @brief Smoothed (exponential moving average) frame timings in milliseconds (see TinyRenderGraph::PaceFrame).
+		struct TinyFrameStats {
+		public:
+			/// @brief Frame start (render events sample input) to presentation. Measured with VK_KHR_present_wait,
+			///     otherwise estimated (upper bound) as frame start to the frame fence being observed signaled.
+			double inputToPresent = 0.0;
+			/// @brief Recording & submitting the render graph (excluding the swapchain acquire).
+			double cpuRecord = 0.0;
+			/// @brief Blocked on the frame fence & swapchain acquire after the frame started.
+			double blocked = 0.0;
+			/// @brief Frame start delayed by PaceFrame (present wait or CPU throttling).
+			double throttled = 0.0;
+			/// @brief Frame start to frame start.
+			double frameInterval = 0.0;
+			/// @brief True if inputToPresent is measured by present wait rather than estimated.
+			bool presentMeasured = false;
+
+			static double Smooth(double average, double sample) { return (average == 0.0)? sample : (average * 0.9) + (sample * 0.1); }
+			static double Milliseconds(std::chrono::steady_clock::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); }
+		};
+
         class TinyRenderGraph : public TinyDisposable {
 		public:
 			TinyVkDevice& vkdevice;
 			TinyWindow* window;
 
-			VkFence swapImageInFlight;
-			VkSemaphore swapImageAvailable, swapImageFinished, swapImageTimeline;
+			/// @brief Frame fence, on the last present pass submit (on the last pass submit for headless graphs without a window).
+			VkFence swapImageInFlight = VK_NULL_HANDLE;
+			VkSemaphore swapImageAvailable = VK_NULL_HANDLE, swapImageFinished = VK_NULL_HANDLE, swapImageTimeline = VK_NULL_HANDLE;
+			/// @brief Frame completion timeline: the last submit of frame N signals N + 1 (see TinyDeletionQueue).
+			VkSemaphore swapFrameTimeline = VK_NULL_HANDLE;
             
 			std::timed_mutex swapChainMutex;
 			TinySurfaceSupporter swapChainPresentDetails;
-			VkQueue swapChainPresentQueue;
+			VkQueue swapChainPresentQueue = VK_NULL_HANDLE;
 			VkSwapchainKHR swapChain;
 			uint32_t swapFrameIndex;
 			std::vector<TinyImage*> swapChainImages;
 			std::vector<TinyImage*> resizableImages;
+			/// @brief Resizable images grow with headroom (allocation = framebuffer size * headroom) and keep their memory when shrinking,
+			///     oversized allocations are compacted once no resize happened for resizeSettleTime (see CompactResizableImages).
+			float resizeHeadroom = 1.25f;
+			std::chrono::milliseconds resizeSettleTime = std::chrono::milliseconds(250);
+			std::chrono::steady_clock::time_point lastResize;
+			bool resizeSettling = false;
+
+			TinyFramePacing framePacing = TinyFramePacing::PACING_THROUGHPUT;
+			/// @brief Time (ms) CPU throttling leaves between the throttled frame start and the predicted end of blocking.
+			double pacingMargin = 2.0;
+			TinyFrameStats frameStats;
+			uint64_t presentId = 0;
+			std::chrono::steady_clock::time_point frameStart;
+			std::array<std::chrono::steady_clock::time_point, 16> presentFrameStarts;
+			double frameBlocked = 0.0, frameRecorded = 0.0;
+			/// @brief Pass to resume the in-progress frame from (swapchain acquire timed out), -1 if no frame is in progress.
+			int32_t frameResumePass = -1;
+			/// @brief The next frame was already paced (its fence wait timed out), retries skip PaceFrame until the frame starts.
+			bool framePaced = false;
+			/// @brief The last frame's fence was observed signaled and sampled into inputToPresent (estimate without present wait).
+			bool frameFenceObserved = false;
 
 			std::atomic_int64_t frameCounter, renderPassCounter;
-			std::atomic_bool presentable, refreshable, frameResized;
+			std::atomic_bool presentable, refreshable, reconfigurable, frameResized;
 			std::vector<TinyRenderPass*> renderPasses;
 			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
 			
@@ -39,15 +84,17 @@
 				}
 				
 				for(TinyRenderPass* pass : renderPasses) delete pass;
+				if (vkdevice.deletionQueue.frameTimeline == swapFrameTimeline) vkdevice.deletionQueue.Detach();
 
-				vkDestroySwapchainKHR(vkdevice.logicalDevice, swapChain, VK_NULL_HANDLE);
+				if (swapChain != VK_NULL_HANDLE) vkDestroySwapchainKHR(vkdevice.logicalDevice, swapChain, VK_NULL_HANDLE);
 				vkDestroySemaphore(vkdevice.logicalDevice, swapImageAvailable, VK_NULL_HANDLE);
 				vkDestroySemaphore(vkdevice.logicalDevice, swapImageFinished, VK_NULL_HANDLE);
 				vkDestroyFence(vkdevice.logicalDevice, swapImageInFlight, VK_NULL_HANDLE);
 				vkDestroySemaphore(vkdevice.logicalDevice, swapImageTimeline, VK_NULL_HANDLE);
+				vkDestroySemaphore(vkdevice.logicalDevice, swapFrameTimeline, VK_NULL_HANDLE);
 			}
 
-			TinyRenderGraph(TinyVkDevice& vkdevice, TinyWindow* window, TinySurfaceSupporter swapChainPresentDetails = TinySurfaceSupporter()) : vkdevice(vkdevice), window(window), swapChainPresentDetails(swapChainPresentDetails), presentable(true), refreshable(false), frameResized(false), swapChain(VK_NULL_HANDLE), renderPassCounter(0), frameCounter(0), swapFrameIndex(0) {
+			TinyRenderGraph(TinyVkDevice& vkdevice, TinyWindow* window, TinySurfaceSupporter swapChainPresentDetails = TinySurfaceSupporter()) : vkdevice(vkdevice), window(window), swapChainPresentDetails(swapChainPresentDetails), presentable(true), refreshable(false), reconfigurable(false), frameResized(false), swapChain(VK_NULL_HANDLE), renderPassCounter(0), frameCounter(0), swapFrameIndex(0) {
 				onDispose.hook(TinyCallback<bool>([this](bool forceDispose) {this->Disposable(forceDispose); }));
 				initialized = Initialize();
 			}
@@ -93,10 +140,14 @@
 			void ResizeFrameBuffer(GLFWwindow* hwndWindow, int width, int height) {
 				if (width == 0 || height == 0) return;
 
+				// The swapchain image views and resizable images (re-allocated below) may still be used by the last frame.
+				TinySwapchain::WaitFences(vkdevice, &swapImageInFlight);
+
 				for(TinyImage* swapImage : swapChainImages) {
 					vkDestroyImageView(vkdevice.logicalDevice, swapImage->imageView, VK_NULL_HANDLE);
 					delete swapImage;
 				}
+				swapChainImages.clear();
 
 				#if TINY_ENGINE_VALIDATION
 					std::cout << "Resizing Window: " << window->hwndWidth << " : " << window->hwndHeight << " -> " << width << " : " << height << std::endl;
@@ -104,30 +155,162 @@
 
 				for(TinyImage* resizableImage : resizableImages) {
 					#if TINY_ENGINE_VALIDATION
-						std::cout << "\t" << "Resizing Image: " << resizableImage->width << " : " << resizableImage->height << " -> " << width << " : " << height << std::endl;
+						VkDeviceSize allocatedWidth = resizableImage->allocatedWidth, allocatedHeight = resizableImage->allocatedHeight;
+					#endif
+					resizableImage->ResizeImage(width, height, resizeHeadroom);
+					#if TINY_ENGINE_VALIDATION
+						std::cout << "\t" << "Resizing Image: " << allocatedWidth << " : " << allocatedHeight << " -> " << width << " : " << height
+							<< ((allocatedWidth != resizableImage->allocatedWidth || allocatedHeight != resizableImage->allocatedHeight)? " (re-allocated)" : " (reused)") << std::endl;
 					#endif
-					resizableImage->Disposable(false);
-					resizableImage->CreateImage(resizableImage->imageType, width, height, resizableImage->imageFormat, resizableImage->addressMode, resizableImage->interpolation);
 				}
+
+				lastResize = std::chrono::steady_clock::now();
+				resizeSettling = true;
 				
 				VkSwapchainKHR oldSwapChain = swapChain;
-				TinySwapchain::CreateSwapChainImages(vkdevice, *window, swapChainPresentDetails, swapChain, swapChainImages);
+				if (TinySwapchain::CreateSwapChainImages(vkdevice, *window, swapChainPresentDetails, swapChain, swapChainImages, swapChainPresentDetails.bufferingMode) != VK_SUCCESS) {
+					// Keeps the old swapchain (not destroyed), the next RenderSwapChain retries the resize.
+					presentable = false;
+					return;
+				}
+
 				TinySwapchain::CreateSwapChainImageViews(vkdevice, swapChainPresentDetails, swapChainImages);
 				vkDestroySwapchainKHR(vkdevice.logicalDevice, oldSwapChain, VK_NULL_HANDLE);
 
+				// Present ids are per swapchain, the new swapchain has nothing to wait on yet.
+				presentId = 0;
 				presentable = true;
 				refreshable = false;
 				frameResized = true;
 			}
 			
-			VkResult ExecuteRenderGraph() {
-				for(TinyRenderPass* pass : renderPasses) {
-					pass->cmdPool.ReturnAllBuffers();
-					pass->timestampIterator = 0;
+			/// @brief Re-allocates resizable images left oversized by shrinking once the framebuffer size settled (no resize for resizeSettleTime).
+			/// Must be called while the resizable images are not in use (after the frame fence wait).
+			void CompactResizableImages() {
+				if (!resizeSettling || std::chrono::steady_clock::now() - lastResize < resizeSettleTime) return;
+				resizeSettling = false;
+
+				for(TinyImage* resizableImage : resizableImages)
+					if (resizableImage->Compactable(resizeHeadroom)) {
+						#if TINY_ENGINE_VALIDATION
+							std::cout << "\t" << "Compacting Image: " << resizableImage->allocatedWidth << " : " << resizableImage->allocatedHeight << " -> " << resizableImage->width << " : " << resizableImage->height << std::endl;
+						#endif
+						resizableImage->ResizeImage(resizableImage->width, resizableImage->height, resizeHeadroom, true);
+						frameResized = true;
+					}
+			}
+			
+			/// @brief Requests a present mode change (e.g. toggling vsync), applied by the next RenderSwapChain via ReconfigureSwapChain.
+			void PushPresentMode(VkPresentModeKHR presentMode) {
+				std::lock_guard<std::timed_mutex> guard(swapChainMutex);
+				TinySwapchain::PushPresentMode(swapChainPresentDetails, presentMode, reconfigurable);
+			}
+
+			/// @brief Requests a swapchain image count change (e.g. triple buffering), applied by the next RenderSwapChain via ReconfigureSwapChain.
+			void PushBufferingMode(TinyBufferingMode bufferingMode) {
+				std::lock_guard<std::timed_mutex> guard(swapChainMutex);
+				TinySwapchain::PushBufferingMode(swapChainPresentDetails, bufferingMode, reconfigurable);
+			}
+
+			/// @brief Re-creates only the swapchain (present mode/image count changes), offscreen and resizable images are kept alive.
+			///     Waits on the last frame's fence only (no device idle), falls back to ResizeFrameBuffer if the window extent changed.
+			VkResult ReconfigureSwapChain() {
+				if (swapChainImages.size() == 0 || swapChainImages.front()->width != static_cast<VkDeviceSize>(window->hwndWidth) || swapChainImages.front()->height != static_cast<VkDeviceSize>(window->hwndHeight)) {
+					ResizeFrameBuffer(window->hwndWindow, window->hwndWidth, window->hwndHeight);
+					reconfigurable = false;
+					return VK_SUCCESS;
 				}
 
+				std::lock_guard<std::timed_mutex> guard(swapChainMutex);
+				VkResult result = TinySwapchain::WaitFences(vkdevice, &swapImageInFlight);
+				if (result != VK_SUCCESS) return result;
+
+				for(TinyImage* swapImage : swapChainImages) {
+					vkDestroyImageView(vkdevice.logicalDevice, swapImage->imageView, VK_NULL_HANDLE);
+					delete swapImage;
+				}
+				swapChainImages.clear();
+				
+				VkSwapchainKHR oldSwapChain = swapChain;
+				result = TinySwapchain::CreateSwapChainImages(vkdevice, *window, swapChainPresentDetails, swapChain, swapChainImages, swapChainPresentDetails.bufferingMode);
+				if (result != VK_SUCCESS) {
+					// swapChain is still the old (retired) swapchain, ResizeFrameBuffer re-creates from it on the next RenderSwapChain.
+					presentable = false;
+					reconfigurable = false;
+					return result;
+				}
+
+				TinySwapchain::CreateSwapChainImageViews(vkdevice, swapChainPresentDetails, swapChainImages);
+				vkDestroySwapchainKHR(vkdevice.logicalDevice, oldSwapChain, VK_NULL_HANDLE);
+
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Reconfigured swapchain [" << swapChainImages.size() << " images, present mode " << swapChainPresentDetails.idealPresentMode << "]" << std::endl;
+				#endif
+
+				// The extent is unchanged, so frameResized is not raised (render events keep their size dependent resources).
+				presentId = 0;
+				presentable = true;
+				reconfigurable = false;
+				return result;
+			}
+			
+			/// @brief Submits an empty fenced batch that waits on the timeline values of the first submittedPasses render passes (frame abandoned at acquire, e.g. out of date swapchain).
+			///     The frame fence and frame timeline then cover the abandoned work, so resizes & command buffer resets in the next frame wait for it.
+			VkResult SubmitAbandonedFrame(int32_t submittedPasses) {
+				VkDeviceSize frameWait = frameCounter * 100;
+				std::vector<VkSemaphoreSubmitInfo> waitInfos;
+				for(int32_t i = 0; i < submittedPasses; i++)
+					waitInfos.push_back({ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = swapImageTimeline, .value = frameWait + renderPasses[i]->subpassIndex, .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT });
+
+				VkSemaphoreSubmitInfo signalInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = swapFrameTimeline, .value = static_cast<uint64_t>(frameCounter + 1), .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT };
+				VkSubmitInfo2 submitInfo { .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+					.waitSemaphoreInfoCount = static_cast<uint32_t>(waitInfos.size()), .pWaitSemaphoreInfos = waitInfos.data(),
+					.signalSemaphoreInfoCount = 1U, .pSignalSemaphoreInfos = &signalInfo };
+
+				vkResetFences(vkdevice.logicalDevice, 1, &swapImageInFlight);
+				return vkQueueSubmit2EKHR(vkdevice.functions, swapChainPresentQueue, 1, &submitInfo, swapImageInFlight);
+			}
+
+			/// @brief Records and submits every render pass, acquiring the swapchain image (with the timeout in nanoseconds) before the first present pass.
+			/// If the acquire times out the passes already submitted are kept and the next call resumes from the first present pass.
+			VkResult ExecuteRenderGraph(uint64_t acquireTimeout = UINT64_MAX) {
+				int32_t firstPass = std::max(0, frameResumePass);
+				frameResumePass = -1;
+
+				if (firstPass == 0)
+					for(TinyRenderPass* pass : renderPasses) {
+						pass->cmdPool.ReturnAllBuffers();
+						pass->timestampIterator = 0;
+					}
+
+				// Only the first present pass waits on swapchain acquire (transfer/offscreen passes never do), the last one signals present & the frame fence.
+				int32_t firstPresentPass = -1, lastPresentPass = -1;
+				for(int32_t i = 0; i < renderPasses.size(); i++)
+					if (renderPasses[i]->pipeline.createInfo.type == TinyPipelineType::TYPE_PRESENT) {
+						if (firstPresentPass < 0) firstPresentPass = i;
+						lastPresentPass = i;
+					}
+				// Headless graphs (no present passes) fence the last pass instead.
+				int32_t fencedPass = (lastPresentPass >= 0)? lastPresentPass : static_cast<int32_t>(renderPasses.size()) - 1;
+
 				VkResult result = VK_SUCCESS;
-				for(int32_t i = 0; i < renderPasses.size(); i++) {
+				for(int32_t i = firstPass; i < renderPasses.size(); i++) {
+					// The swapchain image is acquired lazily, passes before the first present pass are recorded & submitted without waiting on it.
+					if (i == firstPresentPass) {
+						std::chrono::steady_clock::time_point acquireStart = std::chrono::steady_clock::now();
+						result = TinySwapchain::QueryNextSwapChainImage(vkdevice, swapChain, swapFrameIndex, VK_NULL_HANDLE, swapImageAvailable, acquireTimeout);
+						frameBlocked += TinyFrameStats::Milliseconds(std::chrono::steady_clock::now() - acquireStart);
+						if (result == VK_TIMEOUT || result == VK_NOT_READY) {
+							frameResumePass = i;
+							return result;
+						}
+						if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+							// Passes before the first present pass are already submitted without a fence, fence them before abandoning the frame.
+							if (i > 0) SubmitAbandonedFrame(i);
+							return result;
+						}
+					}
+
 					if (renderPasses[i]->pipeline.createInfo.type == TinyPipelineType::TYPE_PRESENT)
 						renderPasses[i]->targetImage = swapChainImages[swapFrameIndex];
 
@@ -146,45 +329,129 @@
 					VkDeviceSize frameWait = frameCounter * 100;
 					VkDeviceSize waitValue = frameWait + renderPasses[i]->timelineWait;
 					VkDeviceSize signalValue = frameWait + renderPasses[i]->subpassIndex;
-					VkSemaphore initialWaits[] = { swapImageAvailable };
-					VkSemaphore dependencyWaits[] { swapImageTimeline };
-					VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-					bool isInitialPass = i == 0 || renderPasses[i]->dependencies.size() == 0;
 
-					VkTimelineSemaphoreSubmitInfo timelineInfo = { .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
-						.waitSemaphoreValueCount = 1, .pWaitSemaphoreValues = &waitValue, .signalSemaphoreValueCount = 1, .pSignalSemaphoreValues = &signalValue };
+					std::vector<VkSemaphoreSubmitInfo> waitInfos, signalInfos;
+					// Dependency waits must cover indirect/vertex input reads of data written by earlier passes, not just color output.
+					if (renderPasses[i]->dependencies.size() > 0)
+						waitInfos.push_back({ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = swapImageTimeline, .value = waitValue, .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT });
+					if (i == firstPresentPass)
+						waitInfos.push_back({ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = swapImageAvailable, .stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT });
 					
-					VkSubmitInfo submitInfo { .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO, .commandBufferCount = 1U, .pCommandBuffers = &cmdbufferPair.first,
-						.pWaitDstStageMask = waitStages, .waitSemaphoreCount = static_cast<uint32_t>(isInitialPass), .pWaitSemaphores = (isInitialPass)? initialWaits : dependencyWaits, .pNext = &timelineInfo };
+					signalInfos.push_back({ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = swapImageTimeline, .value = signalValue, .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT });
+					if (i == lastPresentPass)
+						signalInfos.push_back({ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = swapImageFinished, .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT });
+					// Signal operations cover all earlier submissions on the queue, the last submit marks the whole frame complete.
+					if (i == renderPasses.size() - 1)
+						signalInfos.push_back({ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = swapFrameTimeline, .value = static_cast<uint64_t>(frameCounter + 1), .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT });
+
+					VkCommandBufferSubmitInfo cmdBufferInfo = { .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO, .commandBuffer = cmdbufferPair.first };
+					VkSubmitInfo2 submitInfo { .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+						.waitSemaphoreInfoCount = static_cast<uint32_t>(waitInfos.size()), .pWaitSemaphoreInfos = waitInfos.data(),
+						.commandBufferInfoCount = 1U, .pCommandBufferInfos = &cmdBufferInfo,
+						.signalSemaphoreInfoCount = static_cast<uint32_t>(signalInfos.size()), .pSignalSemaphoreInfos = signalInfos.data() };
 					
-					if (renderPasses[i]->pipeline.createInfo.type == TinyPipelineType::TYPE_PRESENT) {
-						VkSemaphore signalSemaphores[] = {  swapImageFinished };
-						submitInfo.signalSemaphoreCount = 1;
-						submitInfo.pSignalSemaphores = signalSemaphores;
-						result = vkQueueSubmit(swapChainPresentQueue, 1, &submitInfo, swapImageInFlight);
-					} else {
-						result = vkQueueSubmit(renderPasses[i]->pipeline.submitQueue, 1, &submitInfo, VK_NULL_HANDLE);
-					}
+					VkQueue submitQueue = (renderPasses[i]->pipeline.createInfo.type == TinyPipelineType::TYPE_PRESENT)? swapChainPresentQueue : renderPasses[i]->pipeline.submitQueue;
+					// Reset only right before the fenced submit, an early return (e.g. out of date swapchain) leaves the fence signaled.
+					if (i == fencedPass) vkResetFences(vkdevice.logicalDevice, 1, &swapImageInFlight);
+					result = vkQueueSubmit2EKHR(vkdevice.functions, submitQueue, 1, &submitInfo, (i == fencedPass)? swapImageInFlight : VK_NULL_HANDLE);
 				}
 
 				return result;
 			}
 
-			VkResult RenderSwapChain() {
+			/// @brief Present wait is used only if the device enabled VK_KHR_present_id/VK_KHR_present_wait.
+			bool PresentWaitEnabled() { return vkdevice.presentWaitSupported && vkdevice.functions.vkWaitForPresentEXTKHR != VK_NULL_HANDLE; }
+
+			/// @brief PACING_LOW_LATENCY: delays the frame start (and input sampling in render events) until just before it can be rendered.
+			///     With present wait, waits until the previous frame is presented so at most one frame is queued for display.
+			///     Otherwise sleeps for the time previous frames spent blocked on the fence/acquire, minus pacingMargin.
+			///     Neither the present wait nor the sleep exceeds timeout (nanoseconds, RenderSwapChain's timeout).
+			void PaceFrame(uint64_t timeout = UINT64_MAX) {
+				if (framePacing != TinyFramePacing::PACING_LOW_LATENCY) return;
+				std::chrono::steady_clock::time_point pacingStart = std::chrono::steady_clock::now();
+
+				if (PresentWaitEnabled()) {
+					// 100ms timeout: never stall longer than a few refreshes if a present is dropped (e.g. minimized window).
+					if (presentId > 0 && vkWaitForPresentEKHR(vkdevice.functions, vkdevice.logicalDevice, swapChain, presentId, std::min<uint64_t>(timeout, 100000000ULL)) == VK_SUCCESS) {
+						frameStats.inputToPresent = TinyFrameStats::Smooth(frameStats.inputToPresent, TinyFrameStats::Milliseconds(std::chrono::steady_clock::now() - presentFrameStarts[presentId % presentFrameStarts.size()]));
+						frameStats.presentMeasured = true;
+					}
+				} else {
+					// Throttled + blocked is the total idle time per frame, sleeping for it (minus the margin) converges blocking towards the margin.
+					double throttle = std::min({ frameStats.throttled + frameStats.blocked - pacingMargin, frameStats.frameInterval, static_cast<double>(timeout) / 1000000.0 });
+					if (throttle > 0.0) std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(throttle));
+				}
+
+				frameStats.throttled = TinyFrameStats::Smooth(frameStats.throttled, TinyFrameStats::Milliseconds(std::chrono::steady_clock::now() - pacingStart));
+			}
+
+			/// @brief Without present wait, estimates inputToPresent as the last frame's start (frameStart, not yet replaced) to its fence first being observed signaled.
+			void ObserveFrameFence(bool signaled) {
+				if (!signaled || frameFenceObserved || PresentWaitEnabled() || frameCounter == 0) return;
+				frameStats.inputToPresent = TinyFrameStats::Smooth(frameStats.inputToPresent, TinyFrameStats::Milliseconds(std::chrono::steady_clock::now() - frameStart));
+				frameFenceObserved = true;
+			}
+
+			/// @brief Renders and presents one frame. With a finite timeout (nanoseconds) the fence wait, swapchain acquire and minimized window wait
+			///     return VK_TIMEOUT/VK_NOT_READY instead of blocking, so the caller can run other work (simulation, streaming) and call again.
+			///     A frame interrupted at the acquire is resumed from the first present pass (earlier passes are not re-recorded).
+			VkResult RenderSwapChain(uint64_t timeout = UINT64_MAX) {
+				if (window == VK_NULL_HANDLE) return RenderHeadless(timeout);
 				VkResult result = VK_NOT_READY;
-				if (!presentable || refreshable) {
+				bool resumeFrame = frameResumePass >= 0;
+
+				if (!resumeFrame && (!presentable || refreshable)) {
+					// Sleeps on window events while minimized (zero size framebuffer) instead of spinning.
+					if (!window->WaitFrameBufferSize(timeout)) return VK_TIMEOUT;
 					ResizeFrameBuffer(window->hwndWindow, window->hwndWidth, window->hwndHeight);
+				} else if (!resumeFrame && reconfigurable) {
+					result = ReconfigureSwapChain();
 				} else {
-					// Double wait to avoid synch-overlap causing command buffers to still be in use from last present...
-					TinySwapchain::WaitResetFences(vkdevice, &swapImageInFlight);
-					VkResult result = TinySwapchain::QueryNextSwapChainImage(vkdevice, swapChain, swapFrameIndex, swapImageInFlight, swapImageAvailable);
-					TinySwapchain::WaitResetFences(vkdevice, &swapImageInFlight);
+					if (!resumeFrame) {
+						// Sampled before pacing too, so the throttle sleep is not counted when the fence already signaled.
+						ObserveFrameFence(vkGetFenceStatus(vkdevice.logicalDevice, swapImageInFlight) == VK_SUCCESS);
+						if (!framePaced) PaceFrame(timeout);
+						framePaced = true;
+
+						// Wait for the last frame's commands before re-recording them, the swapchain image is acquired later by ExecuteRenderGraph.
+						std::chrono::steady_clock::time_point fenceStart = std::chrono::steady_clock::now();
+						result = TinySwapchain::WaitFences(vkdevice, &swapImageInFlight, timeout);
+						if (result == VK_TIMEOUT) return result;
+						framePaced = false;
+						ObserveFrameFence(true);
+						vkdevice.deletionQueue.BeginFrame(frameCounter + 1);
+						vkdevice.deletionQueue.Collect();
+						CompactResizableImages();
+						std::chrono::steady_clock::time_point recordStart = std::chrono::steady_clock::now();
+						
+						if (frameCounter > 0)
+							frameStats.frameInterval = TinyFrameStats::Smooth(frameStats.frameInterval, TinyFrameStats::Milliseconds(recordStart - frameStart));
+						frameStart = recordStart;
+						frameFenceObserved = false;
+						frameBlocked = TinyFrameStats::Milliseconds(recordStart - fenceStart);
+						frameRecorded = 0.0;
+					} else { result = VK_SUCCESS; }
+
+					std::chrono::steady_clock::time_point executeStart = std::chrono::steady_clock::now();
+					double executeBlocked = frameBlocked;
+					if (result == VK_SUCCESS)
+						result = ExecuteRenderGraph(timeout);
+					frameRecorded += TinyFrameStats::Milliseconds(std::chrono::steady_clock::now() - executeStart) - (frameBlocked - executeBlocked);
 					
-					if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
-						result = ExecuteRenderGraph();
+					// The frame is still in progress (acquire timed out): the caller may do other work, the next call resumes it.
+					if (frameResumePass >= 0) return result;
+
+					frameStats.blocked = TinyFrameStats::Smooth(frameStats.blocked, frameBlocked);
+					frameStats.cpuRecord = TinyFrameStats::Smooth(frameStats.cpuRecord, frameRecorded);
 					
-					if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
-						result = TinySwapchain::QueuePresent(swapChainPresentQueue, swapChain, swapImageFinished, swapFrameIndex);
+					if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR) {
+						uint64_t framePresentId = (PresentWaitEnabled())? presentId + 1 : 0;
+						result = TinySwapchain::QueuePresent(swapChainPresentQueue, swapChain, swapImageFinished, swapFrameIndex, framePresentId);
+						if (framePresentId > 0 && (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)) {
+							presentFrameStarts[framePresentId % presentFrameStarts.size()] = frameStart;
+							presentId = framePresentId;
+						}
+					}
 					
 					presentable = (result == VK_SUCCESS);
 					frameResized = false;
@@ -194,28 +461,58 @@
 				return result;
 			}
 			
+			/// @brief Renders one frame without a swapchain (window is VK_NULL_HANDLE, e.g. offscreen work on a headless device with results
+			///     returned through readbacks). The graph must not contain present passes. With a finite timeout (nanoseconds) the fence wait
+			///     returns VK_TIMEOUT instead of blocking, the next call retries it.
+			VkResult RenderHeadless(uint64_t timeout = UINT64_MAX) {
+				for(TinyRenderPass* pass : renderPasses)
+					if (pass->pipeline.createInfo.type == TinyPipelineType::TYPE_PRESENT) return VK_ERROR_FEATURE_NOT_PRESENT;
+
+				std::chrono::steady_clock::time_point fenceStart = std::chrono::steady_clock::now();
+				VkResult result = TinySwapchain::WaitFences(vkdevice, &swapImageInFlight, timeout);
+				if (result == VK_TIMEOUT) return result;
+				vkdevice.deletionQueue.BeginFrame(frameCounter + 1);
+				vkdevice.deletionQueue.Collect();
+				std::chrono::steady_clock::time_point recordStart = std::chrono::steady_clock::now();
+
+				if (frameCounter > 0)
+					frameStats.frameInterval = TinyFrameStats::Smooth(frameStats.frameInterval, TinyFrameStats::Milliseconds(recordStart - frameStart));
+				frameStart = recordStart;
+				frameStats.blocked = TinyFrameStats::Smooth(frameStats.blocked, TinyFrameStats::Milliseconds(recordStart - fenceStart));
+
+				result = ExecuteRenderGraph();
+				frameStats.cpuRecord = TinyFrameStats::Smooth(frameStats.cpuRecord, TinyFrameStats::Milliseconds(std::chrono::steady_clock::now() - recordStart));
+				frameResized = false;
+				frameCounter ++;
+				return result;
+			}
+
 			VkResult Initialize() {
+				// The frame fence & timelines are created with or without a window, headless graphs render with RenderHeadless.
 				if (window != VK_NULL_HANDLE) {
 					if (!vkdevice.queueFamilyIndices.hasPresentFamily) return VK_ERROR_INITIALIZATION_FAILED;
 					vkGetDeviceQueue(vkdevice.logicalDevice, vkdevice.queueFamilyIndices.presentFamily, 0, &swapChainPresentQueue);
 					
-					TinySwapchain::CreateSwapChainImages(vkdevice, *window, swapChainPresentDetails, swapChain, swapChainImages);
+					TinySwapchain::CreateSwapChainImages(vkdevice, *window, swapChainPresentDetails, swapChain, swapChainImages, swapChainPresentDetails.bufferingMode);
 					TinySwapchain::CreateSwapChainImageViews(vkdevice, swapChainPresentDetails, swapChainImages);
 
-					/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 					VkSemaphoreCreateInfo semaphoreCreateInfo { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
-					VkFenceCreateInfo fenceCreateInfo { .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, .flags = VK_FENCE_CREATE_SIGNALED_BIT };
-
 					vkCreateSemaphore(vkdevice.logicalDevice, &semaphoreCreateInfo, VK_NULL_HANDLE, &swapImageAvailable);
 					vkCreateSemaphore(vkdevice.logicalDevice, &semaphoreCreateInfo, VK_NULL_HANDLE, &swapImageFinished);
-					vkCreateFence(vkdevice.logicalDevice, &fenceCreateInfo, VK_NULL_HANDLE, &swapImageInFlight);
-					/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-					VkSemaphoreTypeCreateInfo timelineCreateInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, .pNext = NULL, .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE, .initialValue = 0 };
-					VkSemaphoreCreateInfo createInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, .pNext = &timelineCreateInfo, .flags = 0 };
-					vkCreateSemaphore(vkdevice.logicalDevice, &createInfo, NULL, &swapImageTimeline);
 				}
 
+				/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+				VkFenceCreateInfo fenceCreateInfo { .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, .flags = VK_FENCE_CREATE_SIGNALED_BIT };
+				VkResult result = vkCreateFence(vkdevice.logicalDevice, &fenceCreateInfo, VK_NULL_HANDLE, &swapImageInFlight);
+				if (result != VK_SUCCESS) return result;
+				/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+				VkSemaphoreTypeCreateInfo timelineCreateInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, .pNext = NULL, .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE, .initialValue = 0 };
+				VkSemaphoreCreateInfo createInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, .pNext = &timelineCreateInfo, .flags = 0 };
+				vkCreateSemaphore(vkdevice.logicalDevice, &createInfo, NULL, &swapImageTimeline);
+				vkCreateSemaphore(vkdevice.logicalDevice, &createInfo, NULL, &swapFrameTimeline);
+				vkdevice.deletionQueue.Attach(vkdevice.functions, vkdevice.logicalDevice, swapFrameTimeline, frameCounter + 1);
+
 				return VK_SUCCESS;
 			}
 		};
@@ -21,10 +21,21 @@
 				destOffset += byteSize;
 			}
 
+			/// @brief Stages sourceData and copies it to the image's rect (the whole image if the extent is 0). A byteSize of 0 is computed
+			///     from the rect and image format, block-compressed (BCn/ASTC) data is staged at a block-aligned offset with rects in whole blocks.
 			void StageBufferToImage(TinyBuffer& stageBuffer, TinyImage& destImage, void* sourceData, VkRect2D rect, VkDeviceSize byteSize, VkDeviceSize& destOffset) {
+				TinyFormatBlock block = QueryFormatBlock(destImage.imageFormat);
+				if (block.width > 1 || block.height > 1) destOffset = (destOffset + block.bytes - 1) / block.bytes * block.bytes;
+				if (byteSize == 0) byteSize = QueryFormatLevelSize(destImage.imageFormat, (rect.extent.width == 0)? destImage.width : rect.extent.width, (rect.extent.height == 0)? destImage.height : rect.extent.height);
+
 				void* stagedOffset = static_cast<int8_t*>(stageBuffer.description.pMappedData) + destOffset;
 				memcpy(stagedOffset, sourceData, (size_t)byteSize);
-				
+				CopyStagedToImage(stageBuffer, destImage, rect, destOffset);
+				destOffset += byteSize;
+			}
+
+			/// @brief Copies image data already written to the staging buffer at stageOffset (e.g. decoded in place by TinyImageLoader).
+			void CopyStagedToImage(TinyBuffer& stageBuffer, TinyImage& destImage, VkRect2D rect, VkDeviceSize stageOffset) {
 				destImage.TransitionLayoutBarrier(executionBuffer.first, TinyCmdBufferSubmitStage::STAGE_BEGIN, TinyImageLayout::LAYOUT_TRANSFER_DST);
 				VkBufferImageCopy region = {
 					.imageSubresource.aspectMask = destImage.aspectFlags, .bufferOffset = 0, .bufferRowLength = 0, .bufferImageHeight = 0,
@@ -32,38 +43,260 @@
 					.imageExtent = { static_cast<uint32_t>((rect.extent.width == 0)?destImage.width:rect.extent.width),
 							static_cast<uint32_t>((rect.extent.height == 0)?destImage.height:rect.extent.height), 1 },
 					.imageOffset = { static_cast<int32_t>(rect.offset.x), static_cast<int32_t>(rect.offset.y), 0 },
-					.bufferOffset = destOffset,
+					.bufferOffset = stageOffset,
 				};
 
 				vkCmdCopyBufferToImage(executionBuffer.first, stageBuffer.buffer, destImage.image, (VkImageLayout) destImage.imageLayout, 1, &region);
 				destImage.TransitionLayoutBarrier(executionBuffer.first, TinyCmdBufferSubmitStage::STAGE_END, TinyImageLayout::LAYOUT_SHADER_READONLY);
-				destOffset += byteSize;
+			}
+
+			/// @brief Converts sourceData (8-bit RGBA/BGRA pixels of sourceFormat) to the image's format while staging it (see TinyPixelConverter),
+			///     then copies it to the image's rect (the whole image if the extent is 0). Returns false for unsupported format pairs.
+			bool StageBufferToImage(TinyBuffer& stageBuffer, TinyImage& destImage, const void* sourceData, VkFormat sourceFormat, VkRect2D rect, VkDeviceSize& destOffset, bool premultiply = false) {
+				TinyPixelConverter converter(sourceFormat, destImage.imageFormat, premultiply);
+				if (!converter.Supported()) return false;
+
+				size_t pixelCount = static_cast<size_t>((rect.extent.width == 0)? destImage.width : rect.extent.width) * ((rect.extent.height == 0)? destImage.height : rect.extent.height);
+				// bufferOffset must be a multiple of the texel size (4 or 8 bytes for 16-bit destinations).
+				destOffset = (destOffset + converter.destBytes - 1) / converter.destBytes * converter.destBytes;
+				converter.Convert(sourceData, static_cast<int8_t*>(stageBuffer.description.pMappedData) + destOffset, pixelCount);
+				CopyStagedToImage(stageBuffer, destImage, rect, destOffset);
+				destOffset += pixelCount * converter.destBytes;
+				return true;
+			}
+
+			/// @brief Copies a staged mip chain (level i at levelOffsets[i], tightly packed) to the image's first levelOffsets.size() mip levels.
+			void CopyStagedLevelsToImage(TinyBuffer& stageBuffer, TinyImage& destImage, const std::vector<VkDeviceSize>& levelOffsets) {
+				std::vector<VkBufferImageCopy> regions;
+				for(uint32_t level = 0; level < std::min<size_t>(levelOffsets.size(), destImage.mipLevels); level++) {
+					regions.push_back({
+						.bufferOffset = levelOffsets[level], .bufferRowLength = 0, .bufferImageHeight = 0,
+						.imageSubresource = { .aspectMask = destImage.aspectFlags, .mipLevel = level, .baseArrayLayer = 0, .layerCount = 1 },
+						.imageOffset = { 0, 0, 0 },
+						.imageExtent = { static_cast<uint32_t>(std::max<VkDeviceSize>(1, destImage.allocatedWidth >> level)), static_cast<uint32_t>(std::max<VkDeviceSize>(1, destImage.allocatedHeight >> level)), 1 },
+					});
+				}
+
+				if (regions.size() == 0) return;
+				destImage.TransitionLayoutBarrier(executionBuffer.first, TinyCmdBufferSubmitStage::STAGE_BEGIN, TinyImageLayout::LAYOUT_TRANSFER_DST);
+				vkCmdCopyBufferToImage(executionBuffer.first, stageBuffer.buffer, destImage.image, (VkImageLayout) destImage.imageLayout, static_cast<uint32_t>(regions.size()), regions.data());
+				destImage.TransitionLayoutBarrier(executionBuffer.first, TinyCmdBufferSubmitStage::STAGE_END, TinyImageLayout::LAYOUT_SHADER_READONLY);
+			}
+
+			/// @brief Copies byteSize bytes (the rest of the buffer for VK_WHOLE_SIZE) of the buffer at offset back to the CPU, the future completes
+			///     once this frame finishes on the GPU (transfer passes only--not within rendering, TYPE_STORAGE or TYPE_INDIRECT buffers).
+			std::future<TinyReadback> ReadbackBuffer(TinyReadbackRing& readbackRing, TinyBuffer& sourceBuffer, VkDeviceSize offset = 0, VkDeviceSize byteSize = VK_WHOLE_SIZE) {
+				if (offset >= sourceBuffer.size) return TinyReadbackRing::Failed(VK_ERROR_VALIDATION_FAILED_EXT);
+				if (byteSize == VK_WHOLE_SIZE) byteSize = sourceBuffer.size - offset;
+
+				TinyBufferBlock block = readbackRing.Allocate(byteSize);
+				if (!block.Valid()) return TinyReadbackRing::Failed(VK_ERROR_OUT_OF_POOL_MEMORY);
+
+				TinyResourceTracker resourceTracker;
+				resourceTracker.Access(sourceBuffer, TinyResourceUsage::USAGE_TRANSFER_READ);
+				resourceTracker.Flush(executionPipeline.vkdevice.functions, executionBuffer.first);
+
+				VkBufferCopy copyRegion { .srcOffset = offset, .dstOffset = block.offset, .size = byteSize };
+				vkCmdCopyBuffer(executionBuffer.first, sourceBuffer.buffer, readbackRing.allocator.buffer.buffer, 1, &copyRegion);
+
+				resourceTracker.bufferBarriers.push_back(readbackRing.GetHostReadBarrier(block, byteSize));
+				resourceTracker.Flush(executionPipeline.vkdevice.functions, executionBuffer.first);
+				return readbackRing.Complete(block, byteSize);
+			}
+
+			/// @brief Copies the image's rect (clamped to the image, to its lower right corner if the extent is 0, mip level 0) back to the CPU as tightly
+			///     packed rows, the future completes once this frame finishes on the GPU (transfer passes only--not within rendering). Uncompressed formats
+			///     only, the image is transitioned back to its current layout after the copy. Swapchain images are not supported (transfer passes run before
+			///     the image is acquired or after it is released to present), render to an offscreen image and read that back instead.
+			std::future<TinyReadback> ReadbackImage(TinyReadbackRing& readbackRing, TinyImage& sourceImage, VkRect2D rect = {}) {
+				if (sourceImage.imageType == TinyImageType::TYPE_SWAPCHAIN) return TinyReadbackRing::Failed(VK_ERROR_FEATURE_NOT_PRESENT);
+				if (QueryFormatCompressed(sourceImage.imageFormat) || QueryFormatBlock(sourceImage.imageFormat).bytes == 0) return TinyReadbackRing::Failed(VK_ERROR_FORMAT_NOT_SUPPORTED);
+				if (rect.offset.x < 0 || rect.offset.y < 0 || static_cast<VkDeviceSize>(rect.offset.x) >= sourceImage.width || static_cast<VkDeviceSize>(rect.offset.y) >= sourceImage.height) return TinyReadbackRing::Failed(VK_ERROR_VALIDATION_FAILED_EXT);
+
+				uint32_t maxWidth = static_cast<uint32_t>(sourceImage.width - rect.offset.x), maxHeight = static_cast<uint32_t>(sourceImage.height - rect.offset.y);
+				uint32_t width = (rect.extent.width == 0)? maxWidth : std::min(rect.extent.width, maxWidth);
+				uint32_t height = (rect.extent.height == 0)? maxHeight : std::min(rect.extent.height, maxHeight);
+
+				VkDeviceSize byteSize = QueryFormatLevelSize(sourceImage.imageFormat, width, height);
+				TinyBufferBlock block = readbackRing.Allocate(byteSize);
+				if (!block.Valid()) return TinyReadbackRing::Failed(VK_ERROR_OUT_OF_POOL_MEMORY);
+
+				TinyImageLayout restoreLayout = sourceImage.imageLayout;
+				TinyResourceTracker resourceTracker;
+				resourceTracker.Access(sourceImage, TinyResourceUsage::USAGE_TRANSFER_READ);
+				resourceTracker.Flush(executionPipeline.vkdevice.functions, executionBuffer.first);
+
+				VkBufferImageCopy region = {
+					.bufferOffset = block.offset, .bufferRowLength = 0, .bufferImageHeight = 0,
+					.imageSubresource = { .aspectMask = sourceImage.aspectFlags, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1 },
+					.imageOffset = { static_cast<int32_t>(rect.offset.x), static_cast<int32_t>(rect.offset.y), 0 },
+					.imageExtent = { width, height, 1 },
+				};
+
+				vkCmdCopyImageToBuffer(executionBuffer.first, sourceImage.image, (VkImageLayout) sourceImage.imageLayout, readbackRing.allocator.buffer.buffer, 1, &region);
+
+				// Later passes may sample/present the image without declaring it, so it is returned to the layout it was in before the copy.
+				if (restoreLayout != TinyImageLayout::LAYOUT_UNDEFINED && restoreLayout != TinyImageLayout::LAYOUT_TRANSFER_SRC)
+					resourceTracker.Access(sourceImage, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT, restoreLayout);
+
+				resourceTracker.bufferBarriers.push_back(readbackRing.GetHostReadBarrier(block, byteSize));
+				resourceTracker.Flush(executionPipeline.vkdevice.functions, executionBuffer.first);
+				return readbackRing.Complete(block, byteSize, sourceImage.imageFormat, width, height);
 			}
 
 			void PushConstant(void* sourceData, TinyShaderStages shaderFlags, VkDeviceSize byteSize) {
 				vkCmdPushConstants(executionBuffer.first, executionPipeline.layout, static_cast<VkShaderStageFlagBits>(shaderFlags), 0, byteSize, sourceData);
 			}
 
-			void PushBuffer(TinyBuffer& uniformBuffer, VkDeviceSize binding) {
-				VkDescriptorBufferInfo bufferDescriptor = uniformBuffer.GetDescriptorInfo();
-				VkWriteDescriptorSet bufferDescriptorSet = uniformBuffer.GetWriteDescriptor(0, 1, &bufferDescriptor);
-				vkCmdPushDescriptorSetEKHR(executionPipeline.vkdevice.instance, executionBuffer.first, VK_PIPELINE_BIND_POINT_GRAPHICS, executionPipeline.layout, 0, 1, &bufferDescriptorSet);
+			void PushBuffer(TinyBuffer& uniformBuffer, VkDeviceSize binding, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE) {
+				VkDescriptorBufferInfo bufferDescriptor = uniformBuffer.GetDescriptorInfo(offset, range);
+				VkWriteDescriptorSet bufferDescriptorSet = uniformBuffer.GetWriteDescriptor(static_cast<uint32_t>(binding), 1, &bufferDescriptor);
+				vkCmdPushDescriptorSetEKHR(executionPipeline.vkdevice.functions, executionBuffer.first, VK_PIPELINE_BIND_POINT_GRAPHICS, executionPipeline.layout, 0, 1, &bufferDescriptorSet);
+			}
+
+			/// @brief Binds a uniform block written to a TinyUniformRing this frame (offset/range into the shared ring buffer).
+			///     Returns VK_ERROR_OUT_OF_DEVICE_MEMORY without binding if the block is invalid (the ring's frame slot was full).
+			VkResult PushUniform(TinyUniformRing& uniformRing, TinyUniformBlock block, VkDeviceSize binding) {
+				if (!block.Valid()) {
+					#if TINY_ENGINE_VALIDATION
+						std::cout << "TinyEngine: Skipped PushUniform of an invalid uniform block at binding " << binding << "." << std::endl;
+					#endif
+					return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+				}
+
+				PushBuffer(uniformRing.ringBuffer, binding, block.offset, block.range);
+				return VK_SUCCESS;
 			}
 
 			void PushImage(TinyImage& uniformImage, VkDeviceSize bindingIndex) {
 				VkDescriptorImageInfo imageDescriptor = uniformImage.GetDescriptorInfo();
-				VkWriteDescriptorSet imageDescriptorSet = uniformImage.GetWriteDescriptor(0, 1, &imageDescriptor);
-				vkCmdPushDescriptorSetEKHR(executionPipeline.vkdevice.instance, executionBuffer.first, VK_PIPELINE_BIND_POINT_GRAPHICS, executionPipeline.layout, 0, 1, &imageDescriptorSet);
+				VkWriteDescriptorSet imageDescriptorSet = uniformImage.GetWriteDescriptor(static_cast<uint32_t>(bindingIndex), 1, &imageDescriptor);
+				vkCmdPushDescriptorSetEKHR(executionPipeline.vkdevice.functions, executionBuffer.first, VK_PIPELINE_BIND_POINT_GRAPHICS, executionPipeline.layout, 0, 1, &imageDescriptorSet);
+			}
+
+			void PushStorageBuffer(TinyBuffer& storageBuffer, VkDeviceSize binding, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE) {
+				VkDescriptorBufferInfo bufferDescriptor = storageBuffer.GetDescriptorInfo(offset, range);
+				VkWriteDescriptorSet bufferDescriptorSet = storageBuffer.GetWriteDescriptor(static_cast<uint32_t>(binding), 1, &bufferDescriptor, TinyDescriptorType::TYPE_STORAGE_BUFFER);
+				vkCmdPushDescriptorSetEKHR(executionPipeline.vkdevice.functions, executionBuffer.first, VK_PIPELINE_BIND_POINT_GRAPHICS, executionPipeline.layout, 0, 1, &bufferDescriptorSet);
+			}
+
+			/// @brief Pushes a storage image (must be in LAYOUT_GENERAL, see ImageBarrier).
+			void PushStorageImage(TinyImage& storageImage, VkDeviceSize bindingIndex) {
+				VkDescriptorImageInfo imageDescriptor = storageImage.GetStorageDescriptorInfo();
+				VkWriteDescriptorSet imageDescriptorSet = storageImage.GetWriteDescriptor(static_cast<uint32_t>(bindingIndex), 1, &imageDescriptor, TinyDescriptorType::TYPE_STORAGE_IMAGE);
+				vkCmdPushDescriptorSetEKHR(executionPipeline.vkdevice.functions, executionBuffer.first, VK_PIPELINE_BIND_POINT_GRAPHICS, executionPipeline.layout, 0, 1, &imageDescriptorSet);
+			}
+
+			void BindBindlessSet(TinyBindlessSet& bindlessSet) {
+				vkCmdBindDescriptorSets(executionBuffer.first, VK_PIPELINE_BIND_POINT_GRAPHICS, executionPipeline.layout, 1, 1, &bindlessSet.descriptorSet, 0, VK_NULL_HANDLE);
 			}
 
 			void BindVertices(TinyBuffer& vertexBuffer, VkDeviceSize bindingIndex) {
 				VkDeviceSize offsets[] = { 0 };
 				vkCmdBindVertexBuffers(executionBuffer.first, 0, 1, &vertexBuffer.buffer, offsets);
 			}
+
+			void BindIndices(TinyBuffer& indexBuffer, VkIndexType indexType = VK_INDEX_TYPE_UINT32, VkDeviceSize offset = 0) {
+				vkCmdBindIndexBuffer(executionBuffer.first, indexBuffer.buffer, offset, indexType);
+			}
 			
 			void DrawInstances(VkDeviceSize vertexCount, VkDeviceSize instanceCount, VkDeviceSize firstVertex, VkDeviceSize firstInstance) {
 				vkCmdDraw(executionBuffer.first, vertexCount, instanceCount, firstVertex, firstInstance);
 			}
+
+			void DrawIndexed(VkDeviceSize indexCount, VkDeviceSize instanceCount, VkDeviceSize firstIndex, int32_t vertexOffset, VkDeviceSize firstInstance) {
+				vkCmdDrawIndexed(executionBuffer.first, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+			}
+
+			/// @brief Draws drawCount VkDrawIndirectCommand(s) read from the indirect buffer (multiDrawIndirect).
+			void DrawIndirect(TinyBuffer& indirectBuffer, VkDeviceSize drawCount, VkDeviceSize offset = 0, uint32_t stride = sizeof(VkDrawIndirectCommand)) {
+				vkCmdDrawIndirect(executionBuffer.first, indirectBuffer.buffer, offset, static_cast<uint32_t>(drawCount), stride);
+			}
+
+			/// @brief Draws drawCount VkDrawIndexedIndirectCommand(s) read from the indirect buffer (multiDrawIndirect).
+			void DrawIndexedIndirect(TinyBuffer& indirectBuffer, VkDeviceSize drawCount, VkDeviceSize offset = 0, uint32_t stride = sizeof(VkDrawIndexedIndirectCommand)) {
+				vkCmdDrawIndexedIndirect(executionBuffer.first, indirectBuffer.buffer, offset, static_cast<uint32_t>(drawCount), stride);
+			}
+
+			/// @brief Draws up to maxDrawCount VkDrawIndirectCommand(s), the actual draw count is a uint32_t read from the count buffer.
+			VkResult DrawIndirectCount(TinyBuffer& indirectBuffer, TinyBuffer& countBuffer, VkDeviceSize maxDrawCount, VkDeviceSize offset = 0, VkDeviceSize countOffset = 0, uint32_t stride = sizeof(VkDrawIndirectCommand)) {
+				return vkCmdDrawIndirectCountEKHR(executionPipeline.vkdevice.functions, executionBuffer.first, indirectBuffer.buffer, offset, countBuffer.buffer, countOffset, static_cast<uint32_t>(maxDrawCount), stride);
+			}
+
+			/// @brief Draws up to maxDrawCount VkDrawIndexedIndirectCommand(s), the actual draw count is a uint32_t read from the count buffer.
+			VkResult DrawIndexedIndirectCount(TinyBuffer& indirectBuffer, TinyBuffer& countBuffer, VkDeviceSize maxDrawCount, VkDeviceSize offset = 0, VkDeviceSize countOffset = 0, uint32_t stride = sizeof(VkDrawIndexedIndirectCommand)) {
+				return vkCmdDrawIndexedIndirectCountEKHR(executionPipeline.vkdevice.functions, executionBuffer.first, indirectBuffer.buffer, offset, countBuffer.buffer, countOffset, static_cast<uint32_t>(maxDrawCount), stride);
+			}
+
+			/// @brief Makes prior transfer writes to the buffer visible to its consumer stage (transfer passes only--not within rendering).
+			void BufferBarrier(TinyBuffer& buffer, TinyCmdBufferSubmitStage cmdBufferStage = TinyCmdBufferSubmitStage::STAGE_BEGIN) {
+				buffer.PipelineBarrier(executionBuffer.first, cmdBufferStage);
+			}
+
+			/// @brief Transitions an image layout, e.g. a TYPE_STORAGE image to LAYOUT_GENERAL (transfer passes only--not within rendering).
+			void ImageBarrier(TinyImage& image, TinyImageLayout newLayout, TinyCmdBufferSubmitStage cmdBufferStage = TinyCmdBufferSubmitStage::STAGE_BEGIN) {
+				image.TransitionLayoutBarrier(executionBuffer.first, cmdBufferStage, newLayout);
+			}
+		};
+
+		/// @brief CPU built list of indirect draw commands (VkDrawIndirectCommand or VkDrawIndexedIndirectCommand).
+		///
+		///     Commands are staged into a TYPE_INDIRECT buffer from a transfer pass and then drawn with a single
+		///     DrawIndirect/DrawIndexedIndirect call. TYPE_INDIRECT buffers are also storage buffers so the same
+		///     command layout can instead be written from shaders and drawn with DrawIndirectCount.
+		template<typename T = VkDrawIndirectCommand>
+		class TinyIndirectBatch {
+		public:
+			std::vector<T> commands;
+
+			TinyIndirectBatch(size_t reserveCount = 0) { commands.reserve(reserveCount); }
+
+			TinyIndirectBatch& Push(const T& command) { commands.push_back(command); return (*this); }
+			void Clear() { commands.clear(); }
+			VkDeviceSize Count() const { return static_cast<VkDeviceSize>(commands.size()); }
+			VkDeviceSize Sizeof() const { return static_cast<VkDeviceSize>(commands.size() * sizeof(T)); }
+			static constexpr uint32_t Stride() { return static_cast<uint32_t>(sizeof(T)); }
+
+			/// @brief Stages the batch into the indirect buffer (at offset 0) and makes it visible to indirect draws.
+			void Stage(TinyRenderObject& renderer, TinyBuffer& stageBuffer, TinyBuffer& indirectBuffer, VkDeviceSize& stageOffset) {
+				if (commands.size() == 0) return;
+				renderer.StageBufferToBuffer(stageBuffer, indirectBuffer, commands.data(), Sizeof(), stageOffset);
+				renderer.BufferBarrier(indirectBuffer, TinyCmdBufferSubmitStage::STAGE_BEGIN);
+			}
+		};
+
+		/// @brief Shared, prebuilt index buffer for drawing up to maxQuads 4-vertex quads (TinyQuad::IndexedVertices).
+		///
+		///     Uses 16-bit indices while every quad corner is addressable (maxQuads <= 16384), otherwise 32-bit.
+		///     The indices never change so Stage() only copies them on its first call.
+		class TinyQuadIndexBuffer : public TinyBuffer {
+		public:
+			const VkDeviceSize maxQuads;
+			const VkIndexType indexType;
+			bool staged;
+
+			TinyQuadIndexBuffer(TinyVkDevice& vkdevice, VkDeviceSize maxQuads = 16384ULL)
+			: TinyBuffer(vkdevice, TinyBufferType::TYPE_INDEX, maxQuads * 6ULL * ((maxQuads * 4ULL <= 65536ULL)? sizeof(uint16_t) : sizeof(uint32_t))),
+			maxQuads(maxQuads), indexType((maxQuads * 4ULL <= 65536ULL)? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32), staged(false) {}
+
+			/// @brief Stages the quad indices once (from a transfer pass), later calls are no-ops.
+			void Stage(TinyRenderObject& renderer, TinyBuffer& stageBuffer, VkDeviceSize& stageOffset) {
+				if (staged) return;
+
+				if (indexType == VK_INDEX_TYPE_UINT16) {
+					std::vector<uint16_t> indices = TinyQuad::GetIndexVector<uint16_t>(maxQuads);
+					renderer.StageBufferToBuffer(stageBuffer, *this, indices.data(), size, stageOffset);
+				} else {
+					std::vector<uint32_t> indices = TinyQuad::GetIndexVector<uint32_t>(maxQuads);
+					renderer.StageBufferToBuffer(stageBuffer, *this, indices.data(), size, stageOffset);
+				}
+
+				renderer.BufferBarrier(*this, TinyCmdBufferSubmitStage::STAGE_BEGIN);
+				staged = true;
+			}
+
+			/// @brief Binds the quad indices for DrawIndexed (6 indices per quad, vertexOffset = 4 * firstQuad).
+			void Bind(TinyRenderObject& renderer) { renderer.BindIndices(*this, indexType, 0); }
 		};
 
         class TinyRenderPass : public TinyDisposable {
@@ -83,14 +316,20 @@
 			TinyInvokable<TinyRenderPass&, TinyRenderObject&, bool> renderEvent;
 
 			std::vector<TinyRenderPass*> dependencies;
+			TinyResourceTracker resourceTracker;
+			std::vector<std::pair<TinyImage*, TinyResourceUsage>> imageAccesses;
+			std::vector<std::pair<TinyBuffer*, TinyResourceUsage>> bufferAccesses;
 			
 			TinyRenderPass operator=(const TinyRenderPass&) = delete;
 			TinyRenderPass(const TinyRenderPass&) = delete;
 			~TinyRenderPass() { this->Dispose(); }
             
 			void Disposable(bool waitIdle) {
-				if (waitIdle) vkDeviceWaitIdle(vkdevice.logicalDevice);
-				if (timestampQueryPool != VK_NULL_HANDLE) vkDestroyQueryPool(vkdevice.logicalDevice, timestampQueryPool, VK_NULL_HANDLE);
+				VkDevice device = vkdevice.logicalDevice;
+				VkQueryPool timestampQueryPool = this->timestampQueryPool;
+				vkdevice.deletionQueue.Push([device, timestampQueryPool]() {
+					if (timestampQueryPool != VK_NULL_HANDLE) vkDestroyQueryPool(device, timestampQueryPool, VK_NULL_HANDLE);
+				}, waitIdle);
 			}
 
 			TinyRenderPass(TinyVkDevice& vkdevice, TinyCommandPool& cmdPool, TinyPipeline& pipeline, TinyImage* targetImage, std::string title, VkDeviceSize subpassIndex, VkDeviceSize localSubpassIndex, uint32_t maxTimestamps = 16U)
@@ -105,8 +344,11 @@
 				initialized = VK_SUCCESS;
 
 				#if TINY_ENGINE_VALIDATION
-					VkQueryPoolCreateInfo queryCreateInfo = { .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, .queryType = VK_QUERY_TYPE_TIMESTAMP, .queryCount = 2U * maxTimestamps * TINY_ENGINE_VALIDATION, .flags = 0 };
-					vkCreateQueryPool(vkdevice.logicalDevice, &queryCreateInfo, VK_NULL_HANDLE, &timestampQueryPool);
+					// The graphics family may lack timestamp support (see QueryPhysicalDeviceQueueFamilies), timestamps are then skipped.
+					if (vkdevice.queueFamilyIndices.timestampValidBits > 0) {
+						VkQueryPoolCreateInfo queryCreateInfo = { .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, .queryType = VK_QUERY_TYPE_TIMESTAMP, .queryCount = 2U * maxTimestamps * TINY_ENGINE_VALIDATION, .flags = 0 };
+						vkCreateQueryPool(vkdevice.logicalDevice, &queryCreateInfo, VK_NULL_HANDLE, &timestampQueryPool);
+					}
 				#endif
 			}
 
@@ -128,15 +370,36 @@
 				return VK_SUCCESS;
 			}
 
+			/// @brief Declares an image this pass reads/writes, its barrier is generated (if needed) before the pass begins.
+			void AddImageAccess(TinyImage* image, TinyResourceUsage usage) {
+				imageAccesses.push_back(std::pair(image, usage));
+			}
+
+			/// @brief Declares a buffer this pass reads/writes, its barrier is generated (if needed) before the pass begins.
+			void AddBufferAccess(TinyBuffer* buffer, TinyResourceUsage usage) {
+				bufferAccesses.push_back(std::pair(buffer, usage));
+			}
+
+			/// @brief Queues the declared accesses of this pass (and optionally its target image) and records them as one barrier.
+			VkResult FlushResourceAccesses(VkCommandBuffer cmdBuffer, TinyImage* attachment = VK_NULL_HANDLE, TinyResourceUsage attachmentUsage = TinyResourceUsage::USAGE_COLOR_ATTACHMENT) {
+				for(std::pair<TinyImage*, TinyResourceUsage>& access : imageAccesses) resourceTracker.Access(*access.first, access.second);
+				for(std::pair<TinyBuffer*, TinyResourceUsage>& access : bufferAccesses) resourceTracker.Access(*access.first, access.second);
+				if (attachment != VK_NULL_HANDLE) resourceTracker.Access(*attachment, attachmentUsage);
+				return resourceTracker.Flush(vkdevice.functions, cmdBuffer);
+			}
+
 			std::vector<float> QueryTimeStamps() {
 				std::vector<float> frametimes;
 				#if TINY_ENGINE_VALIDATION
-					if (timestampIterator > 0) {
+					if (timestampQueryPool != VK_NULL_HANDLE && timestampIterator > 0) {
 						std::vector<VkDeviceSize> timestamps(timestampIterator);
 						vkGetQueryPoolResults(vkdevice.logicalDevice, timestampQueryPool, 0, timestamps.size(), timestamps.size() * sizeof(VkDeviceSize), timestamps.data(), sizeof(VkDeviceSize), VK_QUERY_RESULT_64_BIT);
 						
+						// Only the low timestampValidBits bits are valid, the masked difference also handles a wrapped counter.
+						uint32_t validBits = vkdevice.queueFamilyIndices.timestampValidBits;
+						VkDeviceSize validMask = (validBits >= 64)? ~VkDeviceSize(0) : ((VkDeviceSize(1) << validBits) - 1);
 						for(int i = 0; i < timestampIterator; i += 2) {
-							float deltams = float(timestamps[i+1] - timestamps[i]) * (vkdevice.deviceProperties.properties.limits.timestampPeriod / 1000000.0f);
+							float deltams = float((timestamps[i+1] - timestamps[i]) & validMask) * (vkdevice.deviceProperties.properties.limits.timestampPeriod / 1000000.0f);
 							frametimes.push_back(deltams);
 						}
 					}
@@ -155,12 +418,14 @@
 				}
 				
 				#if TINY_ENGINE_VALIDATION
-					vkCmdResetQueryPool(bufferIndexPair.first, timestampQueryPool, timestampIterator, 2);
-					vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
-					timestampIterator ++;
+					if (timestampQueryPool != VK_NULL_HANDLE) {
+						vkCmdResetQueryPool(bufferIndexPair.first, timestampQueryPool, timestampIterator, 2);
+						vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
+						timestampIterator ++;
+					}
 				#endif
 
-                targetImage->TransitionLayoutBarrier(bufferIndexPair.first, TinyCmdBufferSubmitStage::STAGE_BEGIN, TinyImageLayout::LAYOUT_COLOR_ATTACHMENT);
+				FlushResourceAccesses(bufferIndexPair.first, targetImage, TinyResourceUsage::USAGE_COLOR_ATTACHMENT);
 
 				VkViewport dynamicViewportKHR { .x = 0, .y = 0, .minDepth = 0.0f, .maxDepth = 1.0f, .width = static_cast<float>(targetImage->width), .height = static_cast<float>(targetImage->height) };
 				vkCmdSetViewport(bufferIndexPair.first, 0, 1, &dynamicViewportKHR);
@@ -174,7 +439,7 @@
 					.imageView = targetImage->imageView, .imageLayout = (VkImageLayout) targetImage->imageLayout
 				};
 				VkRenderingInfoKHR dynamicRenderInfo { .sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR, .colorAttachmentCount = 1, .pColorAttachments = &colorAttachmentInfo, .renderArea = renderAreaKHR, .layerCount = 1 };
-				result = vkCmdBeginRenderingEKHR(pipeline.vkdevice.instance, bufferIndexPair.first, &dynamicRenderInfo);
+				result = vkCmdBeginRenderingEKHR(pipeline.vkdevice.functions, bufferIndexPair.first, &dynamicRenderInfo);
 				
 				if (result != VK_SUCCESS) {
 					cmdPool.ReturnBuffer(bufferIndexPair);
@@ -186,14 +451,16 @@
 			}
 			
 			void EndRecordCmdBuffer(std::pair<VkCommandBuffer,int32_t> bufferIndexPair) {
-				VkResult result = vkCmdEndRenderingEKHR(pipeline.vkdevice.instance, bufferIndexPair.first);
-				targetImage->TransitionLayoutBarrier(bufferIndexPair.first, TinyCmdBufferSubmitStage::STAGE_END,
-					(targetImage->imageType == TinyImageType::TYPE_SWAPCHAIN)?
-						TinyImageLayout::LAYOUT_PRESENT_SRC : TinyImageLayout::LAYOUT_SHADER_READONLY);
+				VkResult result = vkCmdEndRenderingEKHR(pipeline.vkdevice.functions, bufferIndexPair.first);
+				resourceTracker.Access(*targetImage, (targetImage->imageType == TinyImageType::TYPE_SWAPCHAIN)?
+					TinyResourceUsage::USAGE_PRESENT : TinyResourceUsage::USAGE_SHADER_READ);
+				resourceTracker.Flush(vkdevice.functions, bufferIndexPair.first);
 						
 				#if TINY_ENGINE_VALIDATION
-					vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
-					timestampIterator ++;
+					if (timestampQueryPool != VK_NULL_HANDLE) {
+						vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
+						timestampIterator ++;
+					}
 				#endif
 
 				vkEndCommandBuffer(bufferIndexPair.first);
@@ -210,18 +477,23 @@
 				}
 				
 				#if TINY_ENGINE_VALIDATION
-					vkCmdResetQueryPool(bufferIndexPair.first, timestampQueryPool, timestampIterator, 2);
-					vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
-					timestampIterator ++;
+					if (timestampQueryPool != VK_NULL_HANDLE) {
+						vkCmdResetQueryPool(bufferIndexPair.first, timestampQueryPool, timestampIterator, 2);
+						vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
+						timestampIterator ++;
+					}
 				#endif
 
+				FlushResourceAccesses(bufferIndexPair.first);
 				return bufferIndexPair;
 			}
 			
 			void EndStageCmdBuffer(std::pair<VkCommandBuffer, int32_t> bufferIndexPair) {
 				#if TINY_ENGINE_VALIDATION
-					vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
-					timestampIterator ++;
+					if (timestampQueryPool != VK_NULL_HANDLE) {
+						vkCmdWriteTimestamp(bufferIndexPair.first, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampQueryPool, timestampIterator);
+						timestampIterator ++;
+					}
 				#endif
 
 				vkEndCommandBuffer(bufferIndexPair.first);
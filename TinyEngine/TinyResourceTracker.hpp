@@ -0,0 +1,179 @@
+#ifndef TINY_ENGINE_TINYRESOURCETRACKER
+#define TINY_ENGINE_TINYRESOURCETRACKER
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Precise (synchronization2) stages, access and image layout of a declared resource usage.
+		struct TinyResourceAccess {
+		public:
+			VkPipelineStageFlags2 stages;
+			VkAccessFlags2 access;
+			TinyImageLayout layout;
+		};
+
+		/// @brief Records the last access of images/buffers (TinyResourceState) and generates only the barriers needed
+		///     between accesses: read-after-read needs none, read-after-write waits only on the writing stages,
+		///     writes/layout transitions wait on the last write and every reader since. All barriers gathered until
+		///     Flush() are merged into a single vkCmdPipelineBarrier2.
+		///
+		///     Each image may only change layout once per Flush() (barriers within one vkCmdPipelineBarrier2 are unordered).
+		class TinyResourceTracker {
+		public:
+			std::vector<VkImageMemoryBarrier2> imageBarriers;
+			std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+
+			static TinyResourceAccess GetUsageAccess(TinyResourceUsage usage) {
+				constexpr VkPipelineStageFlags2 shaderStages = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+				switch (usage) {
+					case TinyResourceUsage::USAGE_TRANSFER_READ:
+						return { VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT, TinyImageLayout::LAYOUT_TRANSFER_SRC };
+					case TinyResourceUsage::USAGE_TRANSFER_WRITE:
+						return { VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, TinyImageLayout::LAYOUT_TRANSFER_DST };
+					case TinyResourceUsage::USAGE_VERTEX_BUFFER:
+						return { VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT, VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT, TinyImageLayout::LAYOUT_UNDEFINED };
+					case TinyResourceUsage::USAGE_INDEX_BUFFER:
+						return { VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT, VK_ACCESS_2_INDEX_READ_BIT, TinyImageLayout::LAYOUT_UNDEFINED };
+					case TinyResourceUsage::USAGE_INDIRECT_BUFFER:
+						return { VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT, TinyImageLayout::LAYOUT_UNDEFINED };
+					case TinyResourceUsage::USAGE_UNIFORM_READ:
+						return { shaderStages, VK_ACCESS_2_UNIFORM_READ_BIT, TinyImageLayout::LAYOUT_UNDEFINED };
+					case TinyResourceUsage::USAGE_SHADER_READ:
+						return { shaderStages, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, TinyImageLayout::LAYOUT_SHADER_READONLY };
+					case TinyResourceUsage::USAGE_FRAGMENT_READ:
+						return { VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, TinyImageLayout::LAYOUT_SHADER_READONLY };
+					case TinyResourceUsage::USAGE_STORAGE_READ:
+						return { shaderStages, VK_ACCESS_2_SHADER_STORAGE_READ_BIT, TinyImageLayout::LAYOUT_GENERAL };
+					case TinyResourceUsage::USAGE_STORAGE_WRITE:
+						return { shaderStages, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, TinyImageLayout::LAYOUT_GENERAL };
+					case TinyResourceUsage::USAGE_STORAGE_READ_WRITE:
+						return { shaderStages, VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, TinyImageLayout::LAYOUT_GENERAL };
+					case TinyResourceUsage::USAGE_COLOR_ATTACHMENT:
+						return { VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, TinyImageLayout::LAYOUT_COLOR_ATTACHMENT };
+					case TinyResourceUsage::USAGE_PRESENT:
+						return { VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, TinyImageLayout::LAYOUT_PRESENT_SRC };
+					case TinyResourceUsage::USAGE_HOST_READ:
+					default:
+						return { VK_PIPELINE_STAGE_2_HOST_BIT, VK_ACCESS_2_HOST_READ_BIT, TinyImageLayout::LAYOUT_UNDEFINED };
+				}
+			}
+
+			/// @brief Declares an image access, queuing a barrier only if the access is not already synchronized.
+			void Access(TinyImage& image, VkPipelineStageFlags2 stages, VkAccessFlags2 access, TinyImageLayout layout) {
+				TinyResourceState& state = image.resourceState;
+				bool layoutChange = layout != image.imageLayout;
+				bool isWrite = TinyResourceState::IsWriteAccess(access);
+				VkPipelineStageFlags2 srcStages;
+				VkAccessFlags2 srcAccess = state.writeAccess;
+
+				if (!layoutChange && !isWrite) {
+					if (state.writeStages == VK_PIPELINE_STAGE_2_NONE || ((stages & ~state.readStages) == 0 && (access & ~state.readAccess) == 0)) {
+						state.readStages |= stages;
+						state.readAccess |= access;
+						return;
+					}
+
+					srcStages = state.writeStages;
+					state.readStages |= stages;
+					state.readAccess |= access;
+				} else {
+					srcStages = state.writeStages | state.readStages;
+					// Acquired swapchain images are waited on at COLOR_ATTACHMENT_OUTPUT, the transition must chain with that semaphore wait.
+					if (image.imageLayout == TinyImageLayout::LAYOUT_PRESENT_SRC) srcStages |= VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+					state.Synchronized(stages, access);
+					if (!layoutChange && srcStages == VK_PIPELINE_STAGE_2_NONE) return;
+				}
+
+				for(VkImageMemoryBarrier2& barrier : imageBarriers) {
+					if (barrier.image == image.image && barrier.newLayout == (VkImageLayout) layout) {
+						barrier.srcStageMask |= srcStages;
+						barrier.srcAccessMask |= srcAccess;
+						barrier.dstStageMask |= stages;
+						barrier.dstAccessMask |= access;
+						return;
+					}
+				}
+
+				#if TINY_ENGINE_VALIDATION
+					for(VkImageMemoryBarrier2& barrier : imageBarriers)
+						if (barrier.image == image.image)
+							std::cout << "TinyEngine: Image transitioned to multiple layouts within one resource tracker flush." << std::endl;
+				#endif
+
+				imageBarriers.push_back({
+					.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+					.srcStageMask = srcStages, .srcAccessMask = srcAccess, .dstStageMask = stages, .dstAccessMask = access,
+					.oldLayout = (VkImageLayout) image.imageLayout, .newLayout = (VkImageLayout) layout,
+					.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .image = image.image,
+					.subresourceRange = { .aspectMask = image.aspectFlags, .baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS, .baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS }
+				});
+				image.imageLayout = layout;
+			}
+
+			/// @brief Declares a buffer access, queuing a barrier only if the access is not already synchronized.
+			void Access(TinyBuffer& buffer, VkPipelineStageFlags2 stages, VkAccessFlags2 access) {
+				TinyResourceState& state = buffer.resourceState;
+				VkPipelineStageFlags2 srcStages;
+				VkAccessFlags2 srcAccess = state.writeAccess;
+
+				if (!TinyResourceState::IsWriteAccess(access)) {
+					if (state.writeStages == VK_PIPELINE_STAGE_2_NONE || ((stages & ~state.readStages) == 0 && (access & ~state.readAccess) == 0)) {
+						state.readStages |= stages;
+						state.readAccess |= access;
+						return;
+					}
+
+					srcStages = state.writeStages;
+					state.readStages |= stages;
+					state.readAccess |= access;
+				} else {
+					srcStages = state.writeStages | state.readStages;
+					state.Synchronized(stages, access);
+					if (srcStages == VK_PIPELINE_STAGE_2_NONE) return;
+				}
+
+				for(VkBufferMemoryBarrier2& barrier : bufferBarriers) {
+					if (barrier.buffer == buffer.buffer) {
+						barrier.srcStageMask |= srcStages;
+						barrier.srcAccessMask |= srcAccess;
+						barrier.dstStageMask |= stages;
+						barrier.dstAccessMask |= access;
+						return;
+					}
+				}
+
+				bufferBarriers.push_back({
+					.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+					.srcStageMask = srcStages, .srcAccessMask = srcAccess, .dstStageMask = stages, .dstAccessMask = access,
+					.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+					.buffer = buffer.buffer, .offset = 0, .size = VK_WHOLE_SIZE
+				});
+			}
+
+			void Access(TinyImage& image, TinyResourceUsage usage) {
+				TinyResourceAccess usageAccess = GetUsageAccess(usage);
+				Access(image, usageAccess.stages, usageAccess.access, (usageAccess.layout == TinyImageLayout::LAYOUT_UNDEFINED)? image.imageLayout : usageAccess.layout);
+			}
+
+			void Access(TinyBuffer& buffer, TinyResourceUsage usage) {
+				TinyResourceAccess usageAccess = GetUsageAccess(usage);
+				Access(buffer, usageAccess.stages, usageAccess.access);
+			}
+
+			size_t PendingBarriers() { return imageBarriers.size() + bufferBarriers.size(); }
+
+			/// @brief Records every queued barrier as one vkCmdPipelineBarrier2 (outside of dynamic rendering only).
+			VkResult Flush(const TinyDeviceFunctions& functions, VkCommandBuffer cmdBuffer) {
+				if (PendingBarriers() == 0) return VK_SUCCESS;
+
+				VkDependencyInfo dependencyInfo = { .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+					.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers.size()), .pBufferMemoryBarriers = bufferBarriers.data(),
+					.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers.size()), .pImageMemoryBarriers = imageBarriers.data() };
+				VkResult result = vkCmdPipelineBarrier2EKHR(functions, cmdBuffer, &dependencyInfo);
+
+				imageBarriers.clear();
+				bufferBarriers.clear();
+				return result;
+			}
+		};
+	}
+#endif
\ No newline at end of file
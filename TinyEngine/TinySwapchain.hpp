@@ -51,17 +51,18 @@
 			}
 
 			/// @brief Acquires the next image from the swap chain and returns out that image index.
-			static inline VkResult QueryNextSwapChainImage(TinyVkDevice& vkdevice, VkSwapchainKHR& swapChain, uint32_t &swapFrameIndex, VkFence imageAcquiredF = VK_NULL_HANDLE, VkSemaphore imageAcquiredS = VK_NULL_HANDLE) {
-				return vkAcquireNextImageKHR(vkdevice.logicalDevice, swapChain, UINT64_MAX, imageAcquiredS, imageAcquiredF, &swapFrameIndex);
+			/// Returns VK_TIMEOUT (or VK_NOT_READY for a zero timeout) if no image is available within the timeout (nanoseconds).
+			static inline VkResult QueryNextSwapChainImage(TinyVkDevice& vkdevice, VkSwapchainKHR& swapChain, uint32_t &swapFrameIndex, VkFence imageAcquiredF = VK_NULL_HANDLE, VkSemaphore imageAcquiredS = VK_NULL_HANDLE, uint64_t timeout = UINT64_MAX) {
+				return vkAcquireNextImageKHR(vkdevice.logicalDevice, swapChain, timeout, imageAcquiredS, imageAcquiredF, &swapFrameIndex);
 			}
 
-			/// @brief Create the Vulkan surface swap-chain images and imageviews.
-			static inline VkResult CreateSwapChainImages(TinyVkDevice& vkdevice, TinyWindow& window, TinySurfaceSupporter& presentDetails, VkSwapchainKHR& swapChain, std::vector<TinyImage*>& swapChainImages) {
+			/// @brief Create the Vulkan surface swap-chain images and imageviews (requested image count is clamped to the surface's supported range).
+			static inline VkResult CreateSwapChainImages(TinyVkDevice& vkdevice, TinyWindow& window, TinySurfaceSupporter& presentDetails, VkSwapchainKHR& swapChain, std::vector<TinyImage*>& swapChainImages, TinyBufferingMode bufferingMode = TinyBufferingMode::MODE_DOUBLE) {
 				TinySwapChainSupporter swapChainSupport = QuerySwapChainSupport(vkdevice.physicalDevice, vkdevice.presentSurface);
 				VkSurfaceFormatKHR surfaceFormat = QuerySwapSurfaceFormat(presentDetails, swapChainSupport.formats);
 				VkPresentModeKHR presentMode = QuerySwapPresentMode(presentDetails, swapChainSupport.presentModes);
 				VkExtent2D extent = QuerySwapExtent(window, swapChainSupport.capabilities);
-				uint32_t imageCount = std::min(swapChainSupport.capabilities.maxImageCount, std::max(swapChainSupport.capabilities.minImageCount, static_cast<uint32_t>(TinyBufferingMode::MODE_DOUBLE)));
+				uint32_t imageCount = std::max(swapChainSupport.capabilities.minImageCount, static_cast<uint32_t>(bufferingMode));
 
 				if (swapChainSupport.capabilities.maxImageCount > 0 && imageCount > swapChainSupport.capabilities.maxImageCount)
 					imageCount = swapChainSupport.capabilities.maxImageCount;
@@ -135,21 +136,35 @@
 				vkWaitForFences(vkdevice.logicalDevice, 1, fence, VK_TRUE, UINT64_MAX);
 				vkResetFences(vkdevice.logicalDevice, 1, fence);
 			}
+
+			/// @brief Waits on VkFence to be signaled without resetting it (reset only right before the next fenced submit).
+			static inline VkResult WaitFences(TinyVkDevice& vkdevice, VkFence* fence, uint64_t timeout = UINT64_MAX) {
+				return vkWaitForFences(vkdevice.logicalDevice, 1, fence, VK_TRUE, timeout);
+			}
 			
-			/// @brief Submits the current acquired swapchain image for presentation.
-			static VkResult QueuePresent(VkQueue presentQueue, VkSwapchainKHR swapchain, VkSemaphore imageFinished, uint32_t swapImageIndex) {
+			/// @brief Submits the current acquired swapchain image for presentation (presentId > 0 tags the present for vkWaitForPresentKHR, requires VK_KHR_present_id).
+			static VkResult QueuePresent(VkQueue presentQueue, VkSwapchainKHR swapchain, VkSemaphore imageFinished, uint32_t swapImageIndex, uint64_t presentId = 0) {
+				VkPresentIdKHR presentIdInfo { .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR, .swapchainCount = 1, .pPresentIds = &presentId };
 				VkPresentInfoKHR presentInfo {
-					.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+					.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR, .pNext = (presentId > 0)? &presentIdInfo : VK_NULL_HANDLE,
 					.waitSemaphoreCount = 1, .pImageIndices = &swapImageIndex, .pWaitSemaphores = &imageFinished,
 					.swapchainCount = 1, .pSwapchains = &swapchain
 				};
 				return vkQueuePresentKHR(presentQueue, &presentInfo);
 			}
 			
-			/// @brief Returns the current resource synchronized frame index.
+			/// @brief Sets the ideal present mode and raises the flag to re-create the swapchain if it changed.
 			static inline void PushPresentMode(TinySurfaceSupporter& presentDetails, VkPresentModeKHR presentMode, std::atomic_bool& refreshFlag) {
 				if (presentMode != presentDetails.idealPresentMode) {
-					presentDetails = { presentDetails.dataFormat, presentDetails.colorSpace, presentMode };
+					presentDetails.idealPresentMode = presentMode;
+					refreshFlag = true;
+				}
+			}
+
+			/// @brief Sets the requested swapchain image count and raises the flag to re-create the swapchain if it changed.
+			static inline void PushBufferingMode(TinySurfaceSupporter& presentDetails, TinyBufferingMode bufferingMode, std::atomic_bool& refreshFlag) {
+				if (bufferingMode != presentDetails.bufferingMode) {
+					presentDetails.bufferingMode = bufferingMode;
 					refreshFlag = true;
 				}
 			}
@@ -0,0 +1,272 @@
+#ifndef TINY_ENGINE_TINYTEXTURESTREAMER
+#define TINY_ENGINE_TINYTEXTURESTREAMER
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Texture registered with a TinyTextureStreamer (owned by the streamer, valid for the streamer's lifetime).
+		class TinyStreamedTexture {
+		public:
+			const std::string path;
+			std::atomic<TinyTextureState> state = TinyTextureState::STATE_QUEUED;
+			/// @brief Higher priorities are decoded and uploaded first (ties go to the most recently used), written by Request from any thread.
+			std::atomic<float> priority;
+			/// @brief Streamer frame the texture was last acquired in (eviction picks the least recently used).
+			uint64_t lastUsed = 0;
+			TinyImageDescription description;
+			TinyBufferBlock staging;
+			/// @brief Staging block relative offset of each decoded mip level.
+			std::vector<VkDeviceSize> levelOffsets;
+			std::unique_ptr<TinyImage> image;
+
+			TinyStreamedTexture operator=(const TinyStreamedTexture&) = delete;
+			TinyStreamedTexture(const TinyStreamedTexture&) = delete;
+			TinyStreamedTexture(const std::string& path, float priority) : path(path), priority(priority) {}
+
+			bool IsResident() { return state == TinyTextureState::STATE_RESIDENT; }
+		};
+
+		/// @brief Streams textures on demand: decoded on a thread pool, uploaded by a transfer pass under a per-frame byte
+		///     budget and evicted (least recently used first) while the resident textures exceed the memory budget.
+		///
+		///     Request(path) registers a texture, Acquire(texture) returns its image once resident or the placeholder image
+		///     until then (and marks the texture as used this frame). Call Stage(renderer) once per frame from a transfer pass
+		///     that the passes acquiring textures depend on, uploads are usable by those passes in the same frame.
+		///     Staging memory is a TinyBufferAllocator, blocks are freed by Stage once the uploading frame completes (the render
+		///     graph's frame timeline attached to TinyDeletionQueue, Stage does nothing without one).
+		class TinyTextureStreamer {
+		private:
+			/// @brief Staging block released once the frame timeline reaches frameValue.
+			struct TinyStagingFree {
+			public:
+				uint64_t frameValue;
+				TinyBufferBlock block;
+			};
+
+			std::mutex streamLock;
+			std::vector<TinyStagingFree> stagingFrees;
+			std::condition_variable decodeSignal;
+			size_t decoding = 0;
+			TinyBufferBlock placeholderBlock;
+			bool placeholderStaged = false;
+
+			static bool Earlier(const TinyStreamedTexture* a, const TinyStreamedTexture* b) {
+				float priorityA = a->priority, priorityB = b->priority;
+				return (priorityA != priorityB)? priorityA > priorityB : a->lastUsed > b->lastUsed;
+			}
+
+			/// @brief Frees the staging block once the frame currently recording completes.
+			void ReleaseStaging(TinyBufferBlock block) {
+				stagingFrees.push_back({ vkdevice.deletionQueue.pendingValue.load(), block });
+			}
+
+			/// @brief Frees the staging blocks of completed frames (non-blocking).
+			void CollectStaging() {
+				uint64_t completedValue = 0;
+				if (stagingFrees.size() == 0 || vkGetSemaphoreCounterValueEKHR(vkdevice.functions, vkdevice.logicalDevice, vkdevice.deletionQueue.frameTimeline, &completedValue) != VK_SUCCESS) return;
+
+				std::erase_if(stagingFrees, [this, completedValue](const TinyStagingFree& stagingFree) {
+					if (stagingFree.frameValue > completedValue) return false;
+					stagingAllocator.Free(stagingFree.block);
+					return true;
+				});
+			}
+
+			/// @brief Maps and decodes the texture into a staging block (thread pool), returns it to the queue if staging memory is full.
+			void Decode(TinyStreamedTexture* texture) {
+				TinyTextureState result = TinyTextureState::STATE_FAILED;
+				TinyMappedFile file(texture->path);
+				TinyImageDescription description;
+
+				bool valid = TinyImageLoader::ReadHeader(file.data, file.size, description);
+				TinyPixelConverter converter = TinyImageLoader::QueryConverter(TinyImageLoader::QueryFileFormat(file.data, file.size), imageFormat, premultiply);
+				if (!converter.Identity()) description.format = converter.destFormat;
+
+				if (valid && converter.Supported() && description.SizeofLevels() <= stagingAllocator.buffer.size) {
+					TinyBufferBlock block = stagingAllocator.Allocate(description.SizeofLevels());
+					texture->description = description;
+
+					if (!block.Valid()) {
+						result = TinyTextureState::STATE_QUEUED;
+					} else if (TinyImageLoader::DecodeLevels(file.data, file.size, description, block.mappedData, block.size, texture->levelOffsets, &threadPool, &converter) == VK_SUCCESS) {
+						texture->staging = block;
+						result = TinyTextureState::STATE_DECODED;
+					} else {
+						stagingAllocator.Free(block);
+					}
+				}
+
+				#if TINY_ENGINE_VALIDATION
+					if (result == TinyTextureState::STATE_FAILED) std::cout << "TinyEngine: Failed to stream texture: " << texture->path << std::endl;
+				#endif
+
+				std::lock_guard<std::mutex> guard(streamLock);
+				texture->state = result;
+				decoding--;
+				decodeSignal.notify_all();
+			}
+
+			/// @brief Starts decoding the queued textures (by priority) up to maxDecoding concurrent decodes.
+			void ScheduleDecodes() {
+				std::vector<TinyStreamedTexture*> scheduled;
+				{
+					std::lock_guard<std::mutex> guard(streamLock);
+					// Textures already known not to fit the free staging memory wait for uploads to release it.
+					VkDeviceSize stagingFree = stagingAllocator.BytesFree();
+					for(std::unique_ptr<TinyStreamedTexture>& texture : textures)
+						if (texture->state == TinyTextureState::STATE_QUEUED && texture->description.SizeofLevels() <= stagingFree) scheduled.push_back(texture.get());
+
+					std::sort(scheduled.begin(), scheduled.end(), Earlier);
+					scheduled.resize(std::min(scheduled.size(), (decoding < maxDecoding)? maxDecoding - decoding : 0));
+					for(TinyStreamedTexture* texture : scheduled) texture->state = TinyTextureState::STATE_DECODING;
+					decoding += scheduled.size();
+				}
+
+				// Enqueued outside of the lock, a pool without workers decodes on the calling thread.
+				for(TinyStreamedTexture* texture : scheduled) threadPool.Enqueue([this, texture]() { Decode(texture); });
+			}
+
+			/// @brief Evicts the least recently used resident textures (unused for evictionDelay frames) until within memoryBudget.
+			void Evict() {
+				std::lock_guard<std::mutex> guard(streamLock);
+				if (residentBytes <= memoryBudget) return;
+
+				std::vector<TinyStreamedTexture*> evictable;
+				for(std::unique_ptr<TinyStreamedTexture>& texture : textures)
+					if (texture->state == TinyTextureState::STATE_RESIDENT && texture->lastUsed + evictionDelay < frameCounter) evictable.push_back(texture.get());
+
+				std::sort(evictable.begin(), evictable.end(), [](const TinyStreamedTexture* a, const TinyStreamedTexture* b) {
+					return (a->lastUsed != b->lastUsed)? a->lastUsed < b->lastUsed : a->priority.load() < b->priority.load(); });
+
+				for(size_t i = 0; i < evictable.size() && residentBytes > memoryBudget; i++) {
+					// Image disposal is deferred (TinyDeletionQueue) until the frames that may still sample it complete.
+					residentBytes -= evictable[i]->description.SizeofLevels();
+					evictable[i]->image.reset();
+					evictable[i]->state = TinyTextureState::STATE_EVICTED;
+				}
+			}
+
+		public:
+			TinyVkDevice& vkdevice;
+			TinyThreadPool& threadPool;
+			TinyBufferAllocator stagingAllocator;
+			TinyImage placeholder;
+			std::vector<std::unique_ptr<TinyStreamedTexture>> textures;
+
+			/// @brief Maximum bytes of resident (uploaded) textures before unused textures are evicted.
+			VkDeviceSize memoryBudget;
+			/// @brief Maximum bytes uploaded per frame (at least one texture is uploaded per frame).
+			VkDeviceSize uploadBudget;
+			VkDeviceSize residentBytes = 0;
+			/// @brief Frames a texture must go unused before it may be evicted.
+			uint64_t evictionDelay = 120;
+			/// @brief Maximum textures decoding at once (each decode also splits across the pool).
+			size_t maxDecoding;
+			/// @brief Format decoded (QOI/PNG) textures are converted to while staged (VK_FORMAT_UNDEFINED: R8G8B8A8_UNORM), optionally premultiplied.
+			VkFormat imageFormat = VK_FORMAT_UNDEFINED;
+			bool premultiply = false;
+			uint64_t frameCounter = 0;
+			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
+
+			TinyTextureStreamer operator=(const TinyTextureStreamer&) = delete;
+			TinyTextureStreamer(const TinyTextureStreamer&) = delete;
+
+			/// @brief Waits for in-flight decodes (they reference this streamer). Pending staging frees are dropped with the
+			///     staging buffer, whose disposal is deferred until the uploading frames complete (TinyDeletionQueue).
+			~TinyTextureStreamer() {
+				std::unique_lock<std::mutex> guard(streamLock);
+				decodeSignal.wait(guard, [this]() { return decoding == 0; });
+			}
+
+			/// @brief Creates the staging memory and the placeholder image (1x1 of placeholderColor, RGBA8 packed as 0xAABBGGRR).
+			TinyTextureStreamer(TinyVkDevice& vkdevice, TinyThreadPool& threadPool, VkDeviceSize stagingSize = 64ULL << 20, VkDeviceSize memoryBudget = 512ULL << 20, VkDeviceSize uploadBudget = 16ULL << 20, uint32_t placeholderColor = 0xFF808080)
+			: vkdevice(vkdevice), threadPool(threadPool), stagingAllocator(vkdevice, stagingSize), placeholder(vkdevice, TinyImageType::TYPE_SHADER_READONLY, 1, 1, VK_FORMAT_R8G8B8A8_UNORM),
+			memoryBudget(memoryBudget), uploadBudget(uploadBudget), maxDecoding(threadPool.WorkerCount() + 1) {
+				initialized = (stagingAllocator.initialized != VK_SUCCESS)? stagingAllocator.initialized : placeholder.initialized;
+				if (initialized != VK_SUCCESS) return;
+
+				placeholderBlock = stagingAllocator.Allocate(sizeof(uint32_t));
+				memcpy(placeholderBlock.mappedData, &placeholderColor, sizeof(uint32_t));
+			}
+
+			/// @brief Registers a texture to stream (or updates the priority of an already registered path).
+			TinyStreamedTexture* Request(const std::string& path, float priority = 0.0f) {
+				std::lock_guard<std::mutex> guard(streamLock);
+				for(std::unique_ptr<TinyStreamedTexture>& texture : textures)
+					if (texture->path == path) { texture->priority = priority; return texture.get(); }
+
+				textures.push_back(std::make_unique<TinyStreamedTexture>(path, priority));
+				textures.back()->lastUsed = frameCounter;
+				return textures.back().get();
+			}
+
+			/// @brief Returns the texture's image if resident, otherwise the placeholder (re-queues evicted textures). Marks the texture as used.
+			TinyImage& Acquire(TinyStreamedTexture* texture) {
+				std::lock_guard<std::mutex> guard(streamLock);
+				texture->lastUsed = frameCounter;
+				if (texture->state == TinyTextureState::STATE_EVICTED) texture->state = TinyTextureState::STATE_QUEUED;
+				return (texture->state == TinyTextureState::STATE_RESIDENT)? *texture->image : placeholder;
+			}
+
+			/// @brief Uploads decoded textures within uploadBudget, evicts over memoryBudget and schedules decodes (call once per frame from a transfer pass).
+			///     Does nothing unless a render graph's frame timeline is attached to the device's deletion queue (staging frees are keyed on it).
+			void Stage(TinyRenderObject& renderer) {
+				if (initialized != VK_SUCCESS) return;
+				if (vkdevice.deletionQueue.frameTimeline == VK_NULL_HANDLE) {
+					#if TINY_ENGINE_VALIDATION
+						std::cout << "TinyEngine: TinyTextureStreamer::Stage requires a render graph frame timeline, nothing staged." << std::endl;
+					#endif
+					return;
+				}
+
+				frameCounter++;
+				CollectStaging();
+
+				if (!placeholderStaged) {
+					renderer.CopyStagedToImage(stagingAllocator.buffer, placeholder, {}, placeholderBlock.offset);
+					ReleaseStaging(placeholderBlock);
+					placeholderStaged = true;
+				}
+
+				std::vector<TinyStreamedTexture*> decoded;
+				{
+					std::lock_guard<std::mutex> guard(streamLock);
+					for(std::unique_ptr<TinyStreamedTexture>& texture : textures)
+						if (texture->state == TinyTextureState::STATE_DECODED) decoded.push_back(texture.get());
+				}
+
+				std::sort(decoded.begin(), decoded.end(), Earlier);
+				VkDeviceSize uploaded = 0;
+
+				for(TinyStreamedTexture* texture : decoded) {
+					VkDeviceSize byteSize = texture->description.SizeofLevels();
+					if (uploaded > 0 && uploaded + byteSize > uploadBudget) break;
+
+					TinyBufferBlock block = texture->staging;
+					texture->staging = {};
+					texture->image = std::make_unique<TinyImage>(vkdevice, TinyImageType::TYPE_SHADER_READONLY, texture->description.width, texture->description.height,
+						texture->description.format, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER, false, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, texture->description.mipLevels);
+
+					if (texture->image->initialized != VK_SUCCESS) {
+						texture->image.reset();
+						stagingAllocator.Free(block);
+						texture->state = TinyTextureState::STATE_FAILED;
+						continue;
+					}
+
+					std::vector<VkDeviceSize> levelOffsets = texture->levelOffsets;
+					for(VkDeviceSize& levelOffset : levelOffsets) levelOffset += block.offset;
+					renderer.CopyStagedLevelsToImage(stagingAllocator.buffer, *texture->image, levelOffsets);
+					ReleaseStaging(block);
+					uploaded += byteSize;
+
+					std::lock_guard<std::mutex> guard(streamLock);
+					residentBytes += byteSize;
+					texture->state = TinyTextureState::STATE_RESIDENT;
+				}
+
+				Evict();
+				ScheduleDecodes();
+			}
+		};
+	}
+#endif
\ No newline at end of file
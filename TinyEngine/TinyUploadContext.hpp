@@ -0,0 +1,246 @@
+#ifndef TINY_ENGINE_TINYUPLOADCONTEXT
+#define TINY_ENGINE_TINYUPLOADCONTEXT
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Submitted upload batch, its staging blocks and command buffer are released once the upload timeline reaches value.
+		struct TinyUploadBatch {
+		public:
+			uint64_t value;
+			std::pair<VkCommandBuffer, int32_t> cmdBuffer;
+			std::vector<TinyBufferBlock> blocks;
+		};
+
+		/// @brief Batched immediate uploads outside of the render graph (e.g. setup/loading time buffers & textures).
+		///
+		///     Copies are staged into a TYPE_STAGING TinyBufferAllocator and recorded into one open command buffer until Submit(),
+		///     which submits the whole batch at once signaling the context's own upload timeline with the batch's value. Staging blocks
+		///     are freed once the timeline reaches that value (Collect, non-blocking), so uploads are bound by bandwidth rather than queue
+		///     round trips. When staging memory runs out the open batch is submitted and completed batches are reclaimed (waiting only on
+		///     the oldest batch if none completed yet). Uses its own command pool, the render graph resets its pools every frame.
+		///
+		///     Batches are submitted to the graphics queue: barriers recorded after each copy (transfer write -> consumer read) make the
+		///     data visible to any later submission on the queue, so render passes may use uploads submitted before them without waiting.
+		///     Submit from one thread at a time and not concurrently with TinyRenderGraph::RenderSwapChain (VkQueue access is not thread-safe).
+		class TinyUploadContext : public TinyDisposable {
+		public:
+			TinyVkDevice& vkdevice;
+			TinyCommandPool cmdPool;
+			TinyBufferAllocator stagingAllocator;
+			TinyResourceTracker resourceTracker;
+			VkQueue submitQueue = VK_NULL_HANDLE;
+			VkSemaphore uploadTimeline = VK_NULL_HANDLE;
+			/// @brief Timeline value signaled by the last submitted batch (0 if none), the open batch signals submittedValue + 1.
+			uint64_t submittedValue = 0;
+			std::pair<VkCommandBuffer, int32_t> batchBuffer = { VK_NULL_HANDLE, -1 };
+			std::vector<TinyBufferBlock> batchBlocks;
+			std::vector<TinyUploadBatch> pendingBatches;
+			VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
+
+			TinyUploadContext operator=(const TinyUploadContext&) = delete;
+			TinyUploadContext(const TinyUploadContext&) = delete;
+			~TinyUploadContext() { this->Dispose(); }
+
+			void Disposable(bool waitIdle) {
+				if (waitIdle && uploadTimeline != VK_NULL_HANDLE) Flush();
+
+				VkDevice device = vkdevice.logicalDevice;
+				VkSemaphore uploadTimeline = this->uploadTimeline;
+				vkdevice.deletionQueue.Push([device, uploadTimeline]() { vkDestroySemaphore(device, uploadTimeline, VK_NULL_HANDLE); }, false);
+			}
+
+			/// @brief Creates an upload context with stagingSize bytes of staging memory and maxBatches in-flight batches (command buffers).
+			TinyUploadContext(TinyVkDevice& vkdevice, VkDeviceSize stagingSize = 67108864ULL, size_t maxBatches = 8UL)
+			: vkdevice(vkdevice), cmdPool(vkdevice, std::max<size_t>(1, maxBatches)), stagingAllocator(vkdevice, stagingSize, TinyBufferType::TYPE_STAGING, 16) {
+				onDispose.hook(TinyCallback<bool>([this](bool forceDispose) {this->Disposable(forceDispose); }));
+				initialized = Initialize();
+			}
+
+			/// @brief Returns the timeline value the GPU has completed (all batches with a value up to it are done).
+			uint64_t CompletedValue() {
+				uint64_t completedValue = 0;
+				vkGetSemaphoreCounterValueEKHR(vkdevice.functions, vkdevice.logicalDevice, uploadTimeline, &completedValue);
+				return completedValue;
+			}
+
+			/// @brief Releases the staging blocks & command buffers of every completed batch (non-blocking), returns the number released.
+			size_t Collect() {
+				uint64_t completedValue = CompletedValue();
+				auto pending = std::stable_partition(pendingBatches.begin(), pendingBatches.end(), [completedValue](const TinyUploadBatch& batch) { return batch.value <= completedValue; });
+
+				for(auto batch = pendingBatches.begin(); batch != pending; batch++) {
+					for(TinyBufferBlock& block : batch->blocks) stagingAllocator.Free(block);
+					cmdPool.ReturnBuffer(batch->cmdBuffer);
+				}
+
+				size_t released = static_cast<size_t>(std::distance(pendingBatches.begin(), pending));
+				pendingBatches.erase(pendingBatches.begin(), pending);
+				return released;
+			}
+
+			/// @brief Blocks until the upload timeline reaches value (e.g. the value returned by Submit), then releases completed batches.
+			VkResult Wait(uint64_t value, uint64_t timeout = UINT64_MAX) {
+				VkSemaphoreWaitInfo waitInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO, .semaphoreCount = 1, .pSemaphores = &uploadTimeline, .pValues = &value };
+				VkResult result = vkWaitSemaphoresEKHR(vkdevice.functions, vkdevice.logicalDevice, &waitInfo, timeout);
+				Collect();
+				return result;
+			}
+
+			/// @brief Submits the open batch (if any copies were recorded) and returns the timeline value it signals once complete.
+			uint64_t Submit() {
+				if (batchBuffer.first == VK_NULL_HANDLE) return submittedValue;
+				vkEndCommandBuffer(batchBuffer.first);
+
+				uint64_t signalValue = submittedValue + 1;
+				VkSemaphoreSubmitInfo signalInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, .semaphore = uploadTimeline, .value = signalValue, .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT };
+				VkCommandBufferSubmitInfo cmdBufferInfo = { .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO, .commandBuffer = batchBuffer.first };
+				VkSubmitInfo2 submitInfo { .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+					.commandBufferInfoCount = 1U, .pCommandBufferInfos = &cmdBufferInfo,
+					.signalSemaphoreInfoCount = 1U, .pSignalSemaphoreInfos = &signalInfo };
+
+				VkResult result = vkQueueSubmit2EKHR(vkdevice.functions, submitQueue, 1, &submitInfo, VK_NULL_HANDLE);
+				if (result != VK_SUCCESS) {
+					#if TINY_ENGINE_VALIDATION
+						std::cout << "TinyEngine: Failed to submit upload batch (" << batchBlocks.size() << " staged copies)." << std::endl;
+					#endif
+
+					// Nothing was submitted, the batch's resources can be released right away.
+					for(TinyBufferBlock& block : batchBlocks) stagingAllocator.Free(block);
+					cmdPool.ReturnBuffer(batchBuffer);
+				} else {
+					submittedValue = signalValue;
+					pendingBatches.push_back({ signalValue, batchBuffer, std::move(batchBlocks) });
+				}
+
+				batchBuffer = { VK_NULL_HANDLE, -1 };
+				batchBlocks.clear();
+				return submittedValue;
+			}
+
+			/// @brief Submits the open batch and waits for every submitted batch to complete (e.g. once after loading).
+			VkResult Flush() {
+				return Wait(Submit());
+			}
+
+			/// @brief Returns the open batch's command buffer, beginning a new batch if none is open (waits on the oldest batch if all command buffers are in flight).
+			VkCommandBuffer BatchBuffer() {
+				if (batchBuffer.first != VK_NULL_HANDLE) return batchBuffer.first;
+
+				Collect();
+				batchBuffer = cmdPool.LeaseBuffer(true);
+				if (batchBuffer.first == VK_NULL_HANDLE && pendingBatches.size() > 0) {
+					Wait(pendingBatches.front().value);
+					batchBuffer = cmdPool.LeaseBuffer(true);
+				}
+
+				if (batchBuffer.first == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+				VkCommandBufferBeginInfo beginInfo { .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT };
+				vkBeginCommandBuffer(batchBuffer.first, &beginInfo);
+				return batchBuffer.first;
+			}
+
+			/// @brief Reserves staging memory for the open batch: if full the open batch is submitted and staging memory of completed
+			///     (or, if none completed, the oldest) batches is reclaimed. Returns an invalid block if byteSize exceeds the staging memory.
+			TinyBufferBlock Reserve(VkDeviceSize byteSize) {
+				TinyBufferBlock block = stagingAllocator.Allocate(byteSize);
+				if (!block.Valid() && byteSize <= stagingAllocator.buffer.size) {
+					Submit();
+					Collect();
+					block = stagingAllocator.Allocate(byteSize);
+
+					while(!block.Valid() && pendingBatches.size() > 0) {
+						if (Wait(pendingBatches.front().value) != VK_SUCCESS) break;
+						block = stagingAllocator.Allocate(byteSize);
+					}
+				}
+
+				#if TINY_ENGINE_VALIDATION
+					if (!block.Valid()) std::cout << "TinyEngine: Upload of " << byteSize << " Bytes exceeds the upload context's staging memory (" << stagingAllocator.buffer.size << " Bytes)." << std::endl;
+				#endif
+
+				if (block.Valid()) batchBlocks.push_back(block);
+				return block;
+			}
+
+			/// @brief Returns a reserved block of the open batch to the staging memory (no batch could be opened to record its copy).
+			VkResult Release(TinyBufferBlock block) {
+				stagingAllocator.Free(block);
+				batchBlocks.pop_back();
+				return VK_ERROR_OUT_OF_POOL_MEMORY;
+			}
+
+			/// @brief Stages byteSize of sourceData and copies it to the buffer at destOffset, visible to the buffer's consumer (see TinyBufferType) once submitted.
+			VkResult StageBuffer(TinyBuffer& destBuffer, const void* sourceData, VkDeviceSize byteSize, VkDeviceSize destOffset = 0) {
+				TinyBufferBlock block = Reserve(byteSize);
+				if (!block.Valid()) return VK_ERROR_OUT_OF_POOL_MEMORY;
+
+				VkCommandBuffer cmdBuffer = BatchBuffer();
+				if (cmdBuffer == VK_NULL_HANDLE) return Release(block);
+				memcpy(block.mappedData, sourceData, (size_t) byteSize);
+
+				resourceTracker.Access(destBuffer, TinyResourceUsage::USAGE_TRANSFER_WRITE);
+				resourceTracker.Flush(vkdevice.functions, cmdBuffer);
+
+				VkBufferCopy copyRegion { .srcOffset = block.offset, .dstOffset = destOffset, .size = byteSize };
+				vkCmdCopyBuffer(cmdBuffer, stagingAllocator.buffer.buffer, destBuffer.buffer, 1, &copyRegion);
+				destBuffer.PipelineBarrier(cmdBuffer, TinyCmdBufferSubmitStage::STAGE_BEGIN);
+				return VK_SUCCESS;
+			}
+
+			/// @brief Stages sourceData and copies it to the image's rect (the whole image if the extent is 0) of mip level 0, the image is left in
+			///     LAYOUT_SHADER_READONLY. A byteSize of 0 is computed from the rect and image format (block-compressed rects in whole blocks).
+			VkResult StageImage(TinyImage& destImage, const void* sourceData, VkRect2D rect = {}, VkDeviceSize byteSize = 0) {
+				VkExtent2D extent = { static_cast<uint32_t>((rect.extent.width == 0)? destImage.width : rect.extent.width), static_cast<uint32_t>((rect.extent.height == 0)? destImage.height : rect.extent.height) };
+				if (byteSize == 0) byteSize = QueryFormatLevelSize(destImage.imageFormat, extent.width, extent.height);
+
+				TinyBufferBlock block = Reserve(byteSize);
+				if (!block.Valid()) return VK_ERROR_OUT_OF_POOL_MEMORY;
+
+				VkCommandBuffer cmdBuffer = BatchBuffer();
+				if (cmdBuffer == VK_NULL_HANDLE) return Release(block);
+				memcpy(block.mappedData, sourceData, (size_t) byteSize);
+
+				resourceTracker.Access(destImage, TinyResourceUsage::USAGE_TRANSFER_WRITE);
+				resourceTracker.Flush(vkdevice.functions, cmdBuffer);
+
+				VkBufferImageCopy region = {
+					.bufferOffset = block.offset, .bufferRowLength = 0, .bufferImageHeight = 0,
+					.imageSubresource = { .aspectMask = destImage.aspectFlags, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1 },
+					.imageOffset = { static_cast<int32_t>(rect.offset.x), static_cast<int32_t>(rect.offset.y), 0 },
+					.imageExtent = { extent.width, extent.height, 1 },
+				};
+
+				vkCmdCopyBufferToImage(cmdBuffer, stagingAllocator.buffer.buffer, destImage.image, (VkImageLayout) destImage.imageLayout, 1, &region);
+				resourceTracker.Access(destImage, TinyResourceUsage::USAGE_SHADER_READ);
+				resourceTracker.Flush(vkdevice.functions, cmdBuffer);
+				return VK_SUCCESS;
+			}
+
+			/// @brief Copies between device buffers in the open batch (no staging memory), e.g. GPU-side compaction after loading.
+			VkResult CopyBuffer(TinyBuffer& sourceBuffer, TinyBuffer& destBuffer, VkDeviceSize byteSize, VkDeviceSize sourceOffset = 0, VkDeviceSize destOffset = 0) {
+				VkCommandBuffer cmdBuffer = BatchBuffer();
+				if (cmdBuffer == VK_NULL_HANDLE) return VK_ERROR_OUT_OF_POOL_MEMORY;
+
+				resourceTracker.Access(sourceBuffer, TinyResourceUsage::USAGE_TRANSFER_READ);
+				resourceTracker.Access(destBuffer, TinyResourceUsage::USAGE_TRANSFER_WRITE);
+				resourceTracker.Flush(vkdevice.functions, cmdBuffer);
+
+				VkBufferCopy copyRegion { .srcOffset = sourceOffset, .dstOffset = destOffset, .size = byteSize };
+				vkCmdCopyBuffer(cmdBuffer, sourceBuffer.buffer, destBuffer.buffer, 1, &copyRegion);
+				destBuffer.PipelineBarrier(cmdBuffer, TinyCmdBufferSubmitStage::STAGE_BEGIN);
+				return VK_SUCCESS;
+			}
+
+			/// @brief Creates the upload timeline and gets the graphics queue batches are submitted to.
+			VkResult Initialize() {
+				if (cmdPool.initialized != VK_SUCCESS) return cmdPool.initialized;
+				if (stagingAllocator.initialized != VK_SUCCESS) return stagingAllocator.initialized;
+				vkGetDeviceQueue(vkdevice.logicalDevice, vkdevice.queueFamilyIndices.graphicsFamily, 0, &submitQueue);
+
+				VkSemaphoreTypeCreateInfo timelineCreateInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, .pNext = NULL, .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE, .initialValue = 0 };
+				VkSemaphoreCreateInfo createInfo = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, .pNext = &timelineCreateInfo, .flags = 0 };
+				return vkCreateSemaphore(vkdevice.logicalDevice, &createInfo, VK_NULL_HANDLE, &uploadTimeline);
+			}
+		};
+	}
+#endif
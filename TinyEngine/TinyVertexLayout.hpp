@@ -0,0 +1,161 @@
+#ifndef TINY_ENGINE_TINYVERTEXLAYOUT
+#define TINY_ENGINE_TINYVERTEXLAYOUT
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Tightly packed vertex attribute types (no GLM_FORCE_DEFAULT_ALIGNED_GENTYPES padding).
+		///
+		///     Every attribute type is 4-byte aligned with a size that is a multiple of 4 bytes, so a plain struct of
+		///     attributes declared in the same order as its TinyVertexLayout has no padding and matches the layout's offsets.
+		///     UNORM/SFLOAT formats are read as floats in shaders, shaders reading vec2/vec3/vec4 need no changes.
+		struct TinyFloat2 {
+			static constexpr VkFormat format = VK_FORMAT_R32G32_SFLOAT;
+			float x, y;
+
+			TinyFloat2() : x(0.0f), y(0.0f) {}
+			TinyFloat2(glm::vec2 v) : x(v.x), y(v.y) {}
+		};
+
+		struct TinyFloat3 {
+			static constexpr VkFormat format = VK_FORMAT_R32G32B32_SFLOAT;
+			float x, y, z;
+
+			TinyFloat3() : x(0.0f), y(0.0f), z(0.0f) {}
+			TinyFloat3(glm::vec3 v) : x(v.x), y(v.y), z(v.z) {}
+		};
+
+		struct TinyFloat4 {
+			static constexpr VkFormat format = VK_FORMAT_R32G32B32A32_SFLOAT;
+			float x, y, z, w;
+
+			TinyFloat4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+			TinyFloat4(glm::vec4 v) : x(v.x), y(v.y), z(v.z), w(v.w) {}
+		};
+
+		/// @brief Two 16-bit floats (e.g. texcoords or small 2D offsets), 4 bytes.
+		struct TinyHalf2 {
+			static constexpr VkFormat format = VK_FORMAT_R16G16_SFLOAT;
+			uint32_t packed;
+
+			TinyHalf2() : packed(0) {}
+			TinyHalf2(glm::vec2 v) : packed(glm::packHalf2x16(v)) {}
+		};
+
+		/// @brief Four 16-bit floats (e.g. positions with depth, exact for integer pixel coordinates up to 2048), 8 bytes.
+		struct TinyHalf4 {
+			static constexpr VkFormat format = VK_FORMAT_R16G16B16A16_SFLOAT;
+			uint32_t packed[2];
+
+			TinyHalf4() : packed{0, 0} {}
+			TinyHalf4(glm::vec4 v) : packed{glm::packHalf2x16(glm::vec2(v.x, v.y)), glm::packHalf2x16(glm::vec2(v.z, v.w))} {}
+			TinyHalf4(glm::vec3 v) : TinyHalf4(glm::vec4(v, 1.0f)) {}
+		};
+
+		/// @brief Two normalized 16-bit values in [0, 1] (texcoords, 1/65535 precision), 4 bytes.
+		struct TinyUnorm16x2 {
+			static constexpr VkFormat format = VK_FORMAT_R16G16_UNORM;
+			uint32_t packed;
+
+			TinyUnorm16x2() : packed(0) {}
+			TinyUnorm16x2(glm::vec2 v) : packed(glm::packUnorm2x16(v)) {}
+		};
+
+		/// @brief Four normalized 8-bit values in [0, 1] (RGBA8 colors), 4 bytes.
+		struct TinyUnorm8x4 {
+			static constexpr VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+			uint32_t packed;
+
+			TinyUnorm8x4() : packed(0xFFFFFFFFU) {}
+			TinyUnorm8x4(glm::vec4 v) : packed(glm::packUnorm4x8(v)) {}
+		};
+
+		/// @brief Single unsigned integer (e.g. bindless texture index), 4 bytes.
+		struct TinyUint1 {
+			static constexpr VkFormat format = VK_FORMAT_R32_UINT;
+			uint32_t value;
+
+			TinyUint1() : value(0) {}
+			TinyUint1(uint32_t v) : value(v) {}
+		};
+
+		/// @brief Compile-time vertex layout: derives the stride, attribute offsets and locations from a declared attribute list.
+		///
+		///     Attributes are assigned consecutive locations (from firstLocation) and packed offsets in declaration order.
+		///     Use Validate<T>(offsetof(T, member)...) inside a static_assert to check a vertex struct matches the declared layout.
+		template<typename... Attributes>
+		struct TinyVertexLayout {
+		public:
+			static constexpr uint32_t count = static_cast<uint32_t>(sizeof...(Attributes));
+			static constexpr std::array<VkFormat, count> formats = { Attributes::format... };
+			static constexpr std::array<uint32_t, count> sizes = { static_cast<uint32_t>(sizeof(Attributes))... };
+
+			static_assert(count > 0, "TinyVertexLayout requires at least one attribute.");
+			static_assert(((sizeof(Attributes) % 4 == 0) && ...), "TinyVertexLayout attribute sizes must be multiples of 4 bytes.");
+			static_assert(((alignof(Attributes) <= 4) && ...), "TinyVertexLayout attributes must be at most 4-byte aligned (use the Tiny packed attribute types).");
+
+			static constexpr std::array<uint32_t, count> offsets = []() {
+				std::array<uint32_t, count> result {};
+				uint32_t offset = 0;
+				for(uint32_t i = 0; i < count; i++) { result[i] = offset; offset += sizes[i]; }
+				return result;
+			}();
+
+			static constexpr uint32_t stride = (static_cast<uint32_t>(sizeof(Attributes)) + ...);
+
+			/// @brief Returns true if the vertex type has the layout's size (no padding) and standard layout.
+			template<typename T>
+			static constexpr bool Validate() { return sizeof(T) == stride && std::is_standard_layout_v<T>; }
+
+			/// @brief Returns true if Validate<T>() holds and each member offset (offsetof(T, member), in attribute order) matches the attribute's offset.
+			template<typename T, typename... Offsets>
+			static constexpr bool Validate(Offsets... memberOffsets) {
+				static_assert(sizeof...(Offsets) == count, "TinyVertexLayout::Validate requires one member offset per attribute.");
+				std::array<size_t, count> structOffsets = { static_cast<size_t>(memberOffsets)... };
+				for(uint32_t i = 0; i < count; i++) if (structOffsets[i] != offsets[i]) return false;
+				return Validate<T>();
+			}
+
+			static VkVertexInputBindingDescription GetBindingDescription(uint32_t binding = 0, VkVertexInputRate inputRate = VK_VERTEX_INPUT_RATE_VERTEX) {
+				return { .binding = binding, .stride = stride, .inputRate = inputRate };
+			}
+
+			static const std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions(uint32_t binding = 0, uint32_t firstLocation = 0) {
+				std::vector<VkVertexInputAttributeDescription> attributes(count);
+				for(uint32_t i = 0; i < count; i++)
+					attributes[i] = { .location = firstLocation + i, .binding = binding, .format = formats[i], .offset = offsets[i] };
+				return attributes;
+			}
+
+			static TinyVertexDescription GetVertexDescription(uint32_t binding = 0, VkVertexInputRate inputRate = VK_VERTEX_INPUT_RATE_VERTEX) {
+				return TinyVertexDescription(GetBindingDescription(binding, inputRate), GetAttributeDescriptions(binding));
+			}
+		};
+
+		/// @brief 20 byte TinyVertex equivalent (TinyVertex is 48 bytes with aligned GLM types), same locations as TinyVertex:
+		///     texcoord (location 0, R16G16_UNORM), position (location 1, R32G32B32_SFLOAT), color (location 2, R8G8B8A8_UNORM).
+		///     Works with the default shaders unchanged (texcoords must be in [0, 1]).
+		struct TinyCompactVertex {
+		public:
+			using Layout = TinyVertexLayout<TinyUnorm16x2, TinyFloat3, TinyUnorm8x4>;
+			TinyUnorm16x2 texcoord;
+			TinyFloat3 position;
+			TinyUnorm8x4 color;
+
+			TinyCompactVertex() : texcoord(glm::vec2(0.0)), position(glm::vec3(0.0)), color(glm::vec4(1.0)) {}
+			TinyCompactVertex(glm::vec2 tex, glm::vec3 pos, glm::vec4 col) : texcoord(tex), position(pos), color(col) {}
+			TinyCompactVertex(const TinyVertex& vertex) : texcoord(vertex.texcoord), position(vertex.position), color(vertex.color) {}
+
+			static TinyVertexDescription GetVertexDescription() { return Layout::GetVertexDescription(); }
+			static VkVertexInputBindingDescription GetBindingDescription() { return Layout::GetBindingDescription(); }
+			static const std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions() { return Layout::GetAttributeDescriptions(); }
+
+			/// @brief Packs a TinyVertex list (e.g. TinyQuad::GetVertexVector) into compact vertices.
+			const static std::vector<TinyCompactVertex> GetVertexVector(const std::vector<TinyVertex>& vertices) {
+				return std::vector<TinyCompactVertex>(vertices.begin(), vertices.end());
+			}
+		};
+
+		static_assert(sizeof(TinyCompactVertex) == 20, "TinyCompactVertex must be 20 bytes.");
+		static_assert(TinyCompactVertex::Layout::Validate<TinyCompactVertex>(offsetof(TinyCompactVertex, texcoord), offsetof(TinyCompactVertex, position), offsetof(TinyCompactVertex, color)), "TinyCompactVertex does not match its vertex layout.");
+	}
+#endif
\ No newline at end of file
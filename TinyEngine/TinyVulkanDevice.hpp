@@ -13,6 +13,10 @@
 				VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME,
 				VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
 				VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME,
+				VK_KHR_MAINTENANCE_3_EXTENSION_NAME,
+				VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+				VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME,
+				VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
 				VK_KHR_SWAPCHAIN_EXTENSION_NAME,
 				VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME
 			}, validationLayers = {}, instanceExtensions = {};
@@ -27,6 +31,13 @@
             VmaAllocator memoryAllocator = VK_NULL_HANDLE;
 			VkSurfaceKHR presentSurface = VK_NULL_HANDLE;
 			TinyQueueFamily queueFamilyIndices = {};
+			TinyDeviceSelector deviceSelector;
+			/// @brief Selection score of the physical device (see TinyDeviceSelector).
+			int64_t deviceScore = -1;
+			bool presentWaitSupported = false;
+			/// @brief Extension functions of this device's logical device (see TinyDeviceFunctions).
+			TinyDeviceFunctions functions;
+			TinyDeletionQueue deletionQueue;
             VkResult initialized = VK_ERROR_INITIALIZATION_FAILED;
 
 			TinyVkDevice(const TinyVkDevice&) = delete;
@@ -36,6 +47,7 @@
 			/// @brief Manually calls dispose on resources without deleting the object.
 			void Disposable(bool waitIdle) {
 				if (waitIdle) vkDeviceWaitIdle(logicalDevice);
+				deletionQueue.Flush();
 				if (memoryAllocator != VK_NULL_HANDLE) vmaDestroyAllocator(memoryAllocator);
 				if (logicalDevice != VK_NULL_HANDLE) vkDestroyDevice(logicalDevice, VK_NULL_HANDLE);
 				if (presentSurface != VK_NULL_HANDLE) vkDestroySurfaceKHR(instance, presentSurface, VK_NULL_HANDLE);
@@ -44,8 +56,10 @@
 			}
 
 			/// @brief Create managed VkDevice via Vulkan API. Automatically calls Initialize().
-			TinyVkDevice(TinyWindow* window = VK_NULL_HANDLE, VkPhysicalDeviceFeatures deviceFeatures = { .multiDrawIndirect = VK_TRUE })
-			: window(window), deviceFeatures(deviceFeatures) {
+			///     Without a window the device is headless (no surface/swapchain, e.g. offscreen rendering), each TinyVkDevice owns its own
+			///     instance and extension functions (TinyDeviceFunctions) so several devices can be opened on different GPUs (see TinyDeviceSelector).
+			TinyVkDevice(TinyWindow* window = VK_NULL_HANDLE, VkPhysicalDeviceFeatures deviceFeatures = { .multiDrawIndirect = VK_TRUE, .vertexPipelineStoresAndAtomics = VK_TRUE, .fragmentStoresAndAtomics = VK_TRUE }, TinyDeviceSelector deviceSelector = {})
+			: window(window), deviceFeatures(deviceFeatures), deviceSelector(deviceSelector) {
 				onDispose.hook(TinyCallback<bool>([this](bool forceDispose) {this->Disposable(forceDispose); }));
 				initialized = Initialize();
 			}
@@ -70,27 +84,93 @@
 				VkResult result = vkCreateInstance(&createInfo, VK_NULL_HANDLE, &instance);
 				if (result != VK_SUCCESS) return result;
 
-				presentSurface = window->CreateWindowSurface(instance);
+				if (window != VK_NULL_HANDLE) presentSurface = window->CreateWindowSurface(instance);
 				return CreateDebugUtilsMessengerEXT(instance, &defaultDebugCreateInfo, VK_NULL_HANDLE, &debugMessenger);
 			}
 
-			/// @brief Returns the highest ranked GPU by device memory heap size (regardless of compatibility of settings) and creates its VMA allocator.
+			/// @brief Selects the GPU by the device selector's override (deviceIndex, deviceName) or the highest capability score (see TinyDeviceSelector).
+			///     Devices lacking the device extensions or a graphics (& present) queue family are never selected, headless devices don't require swapchains.
 			VkResult CreatePhysicalDevice() {
-				std::vector<VkPhysicalDevice> suitableDevices;
-				QueryPhysicalDevices(instance, suitableDevices);
-				std::sort(suitableDevices.begin(), suitableDevices.end(), [this](VkPhysicalDevice A, VkPhysicalDevice B) { return QueryPhysicalDeviceRankByHeapSize(A) >= QueryPhysicalDeviceRankByHeapSize(B); });
-				physicalDevice = (suitableDevices.size() > 0)? suitableDevices.front() : VK_NULL_HANDLE;
+				if (presentSurface == VK_NULL_HANDLE)
+					std::erase_if(deviceExtensions, [](const char* extension) { return std::string(extension) == VK_KHR_SWAPCHAIN_EXTENSION_NAME; });
+
+				std::vector<VkPhysicalDevice> devices;
+				QueryPhysicalDevices(instance, devices);
+				physicalDevice = VK_NULL_HANDLE;
+				deviceScore = -1;
+				bool overrideMatched = false;
+
+				for(int32_t i = 0; i < devices.size(); i++) {
+					int64_t score = QueryPhysicalDeviceScore(devices[i], presentSurface, deviceExtensions, deviceSelector);
+					if (score < 0) continue;
+
+					VkPhysicalDeviceProperties properties {};
+					vkGetPhysicalDeviceProperties(devices[i], &properties);
+					bool selected = (deviceSelector.deviceIndex == i) || (deviceSelector.deviceName.size() > 0 && std::string(properties.deviceName).find(deviceSelector.deviceName) != std::string::npos);
+
+					if (selected) {
+						physicalDevice = devices[i];
+						deviceScore = score;
+						overrideMatched = true;
+						break;
+					}
+
+					if (score > deviceScore) {
+						physicalDevice = devices[i];
+						deviceScore = score;
+					}
+				}
+
+				#if TINY_ENGINE_VALIDATION
+					if ((deviceSelector.deviceIndex >= 0 || deviceSelector.deviceName.size() > 0) && !overrideMatched)
+						std::cout << "TinyEngine: Device override (index/name) did not match a suitable device, falling back to the highest scoring device." << std::endl;
+				#endif
+
 				return (physicalDevice == VK_NULL_HANDLE)? VK_ERROR_DEVICE_LOST : VK_SUCCESS;
 			}
 
-			/// @brief Creates the logical devices for the graphics/present queue families.
+			/// @brief Returns true if the physical device supports VK_KHR_present_id and VK_KHR_present_wait (requires a window surface).
+			bool QueryPresentWaitSupport() {
+				if (presentSurface == VK_NULL_HANDLE) return false;
+				if (!QueryDeviceExtensionSupport(physicalDevice, VK_KHR_PRESENT_ID_EXTENSION_NAME) || !QueryDeviceExtensionSupport(physicalDevice, VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) return false;
+
+				VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR };
+				VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR, .pNext = &presentWaitFeatures };
+				VkPhysicalDeviceFeatures2 features = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, .pNext = &presentIdFeatures };
+				vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+				return presentIdFeatures.presentId == VK_TRUE && presentWaitFeatures.presentWait == VK_TRUE;
+			}
+
+			/// @brief Creates the logical devices for the graphics/present/transfer queue families.
 			VkResult CreateLogicalDevice() {
 				if (physicalDevice == VK_NULL_HANDLE) return VK_ERROR_DEVICE_LOST;
 
 				std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
 				queueFamilyIndices = QueryPhysicalDeviceQueueFamilies(physicalDevice, presentSurface);
-				std::set<uint32_t> uniqueQueueFamilies = { queueFamilyIndices.graphicsFamily, queueFamilyIndices.presentFamily };
-                if (!queueFamilyIndices.hasGraphicsFamily || !queueFamilyIndices.hasPresentFamily) return VK_ERROR_INITIALIZATION_FAILED;
+                if (!queueFamilyIndices.hasGraphicsFamily || (presentSurface != VK_NULL_HANDLE && !queueFamilyIndices.hasPresentFamily)) return VK_ERROR_INITIALIZATION_FAILED;
+				std::set<uint32_t> uniqueQueueFamilies = { queueFamilyIndices.graphicsFamily, queueFamilyIndices.transferFamily };
+				if (queueFamilyIndices.hasPresentFamily) uniqueQueueFamilies.insert(queueFamilyIndices.presentFamily);
+
+				// Optional shader storage write features are only enabled where supported (storage buffer/image writes from vertex/fragment shaders).
+				VkPhysicalDeviceFeatures supportedFeatures {};
+				vkGetPhysicalDeviceFeatures(physicalDevice, &supportedFeatures);
+				deviceFeatures.vertexPipelineStoresAndAtomics &= supportedFeatures.vertexPipelineStoresAndAtomics;
+				deviceFeatures.fragmentStoresAndAtomics &= supportedFeatures.fragmentStoresAndAtomics;
+
+				// Block-compressed texture formats are enabled wherever supported (see QueryFormatSupport for per-format support).
+				deviceFeatures.textureCompressionBC = supportedFeatures.textureCompressionBC;
+				deviceFeatures.textureCompressionASTC_LDR = supportedFeatures.textureCompressionASTC_LDR;
+
+				// Optional present id/wait (low latency frame pacing) are only enabled if the device supports both extensions and features.
+				VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures = defaultPresentWaitFeatures;
+				VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures = defaultPresentIdFeatures;
+				presentWaitSupported = QueryPresentWaitSupport();
+				if (presentWaitSupported) {
+					deviceExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+					deviceExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+					presentIdFeatures.pNext = &presentWaitFeatures;
+					presentWaitFeatures.pNext = const_cast<VkPhysicalDeviceDynamicRenderingFeatures*>(&defaultDynamicRenderingCreateInfo);
+				}
 
 				float queuePriority = 1.0f;
 				for (uint32_t queueFamily : uniqueQueueFamilies)
@@ -100,7 +180,7 @@
 					.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
 					.pQueueCreateInfos = queueCreateInfos.data(), .queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size()),
 					.ppEnabledExtensionNames = deviceExtensions.data(), .enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size()),
-					.pEnabledFeatures = &deviceFeatures, .pNext = &defaultDynamicRenderingCreateInfo
+					.pEnabledFeatures = &deviceFeatures, .pNext = (presentWaitSupported)? static_cast<const void*>(&presentIdFeatures) : &defaultDynamicRenderingCreateInfo
 				};
 
 				return vkCreateDevice(physicalDevice, &createInfo, VK_NULL_HANDLE, &logicalDevice);
@@ -112,13 +192,23 @@
 				return vmaCreateAllocator(&allocatorCreateInfo, &memoryAllocator);
 			}
 
+			/// @brief Returns true if optimally tiled images of the format support the format features (e.g. sampling BC7/ASTC textures).
+			bool QueryFormatSupport(VkFormat format, VkFormatFeatureFlags features = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT) {
+				VkFormatProperties properties {};
+				vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &properties);
+				return (properties.optimalTilingFeatures & features) == features;
+			}
+
 			/// @brief Initializes the Vulkan Instance, Creates VMAllocator and Queries required Logical/Physical Device(s).
 			VkResult Initialize() {
 				VkResult result = VK_SUCCESS;
 				if ((result = CreateVkInstance()) != VK_SUCCESS) return result;
-				if ((result = vkCmdRenderingGetCallbacks(instance)) != VK_SUCCESS) return result;
 				if ((result = CreatePhysicalDevice()) != VK_SUCCESS) return result;
 				if ((result = CreateLogicalDevice()) != VK_SUCCESS) return result;
+				if ((result = functions.Load(logicalDevice)) != VK_SUCCESS) return result;
+				presentWaitSupported = presentWaitSupported && functions.vkWaitForPresentEXTKHR != VK_NULL_HANDLE;
+				deletionQueue.functions = &functions;
+				deletionQueue.device = logicalDevice;
 				result = CreateMemoryAllocator();
 
 				#if TINY_ENGINE_VALIDATION
@@ -128,9 +218,13 @@
 					std::cout << "TinyEngine: GPU Device Info" << std::endl;
 					std::cout << "\tValid Logical Device:    " << (result == VK_SUCCESS?"True":"False") << std::endl;
 					std::cout << "\tPhysical Device Name:    " << deviceProperties.properties.deviceName << std::endl;
+					std::cout << "\tDevice Type / Score:     " << deviceProperties.properties.deviceType << " / " << deviceScore << std::endl;
+					std::cout << "\tDedicated Transfer:      " << (queueFamilyIndices.DedicatedTransfer()?"True":"False") << " (family " << queueFamilyIndices.transferFamily << ")" << std::endl;
 					std::cout << "\tDevice Rank / Heap Size: " << (QueryPhysicalDeviceRankByHeapSize(physicalDevice) / 1000000000) << " GB" << std::endl;
 					std::cout << "\tPush Constant Memory:    " << deviceProperties.properties.limits.maxPushConstantsSize << " Bytes" << std::endl;
 					std::cout << "\tPush Descriptor Memory:  " << pushDescriptorProperties.maxPushDescriptors << " Count" << std::endl;
+					std::cout << "\tPresent Wait Support:    " << (presentWaitSupported?"True":"False") << std::endl;
+					std::cout << "\tBC / ASTC Compression:   " << (deviceFeatures.textureCompressionBC?"True":"False") << " / " << (deviceFeatures.textureCompressionASTC_LDR?"True":"False") << std::endl;
 				#endif
 				return result;
 			}
@@ -13,6 +13,10 @@
 			
 			/// @brief GLFW window identifier handle (pointer).
             GLFWwindow* hwndWindow;
+
+			/// @brief Guards hwndWidth/hwndHeight updates, signaled when the framebuffer is resized or the window closes.
+			std::mutex frameBufferLock;
+			std::condition_variable frameBufferResized;
 			
 			/// @brief Executes functions in the main window loop (w/ ref to bool to exit loop as needed).
 			TinyInvokable<std::atomic_bool&> onWhileMain;
@@ -45,7 +49,13 @@
 			TinyWindow(std::string title, int width, int height, bool resizable, bool transparent = false, bool bordered = true, bool fullscreen = false, bool hasMinSize = false, int minWidth = 200, int minHeight = 200)
 			: hwndResizable(resizable), hwndTransparent(transparent), hwndBordered(bordered), hwndFullscreen(fullscreen), hwndMinSize(hasMinSize), hwndWidth(width), hwndHeight(height), minWidth(minWidth), minHeight(minHeight), hwndTitle(title), hwndWindow(VK_NULL_HANDLE) {
 				onDispose.hook(TinyCallback<bool>([this](bool forceDispose){this->Disposable(forceDispose); }));
-				onWindowResized.hook(TinyCallback<GLFWwindow*, int, int>([this](GLFWwindow* hwnd, int width, int height) { if (hwnd != hwndWindow) return; hwndWidth = width; hwndHeight = height; }));
+				onWindowResized.hook(TinyCallback<GLFWwindow*, int, int>([this](GLFWwindow* hwnd, int width, int height) {
+					if (hwnd != hwndWindow) return;
+					std::lock_guard<std::mutex> guard(frameBufferLock);
+					hwndWidth = width;
+					hwndHeight = height;
+					frameBufferResized.notify_all();
+				}));
 				onWindowPositionMoved.hook(TinyCallback<GLFWwindow*, int, int>([this](GLFWwindow* hwnd, int xpos, int ypos) { if (hwnd != hwndWindow) return; hwndXpos = xpos; hwndYpos = ypos; }));
 				initialized = Initialize();
 			}
@@ -61,16 +71,24 @@
 				onWindowPositionMoved.invoke(hwnd, xpos, ypos);
 			}
 
-			/// @brief Pass to render engine for swapchain resizing.
-			void OnFrameBufferReSizeCallback(int& width, int& height) {
-				width = 0;
-				height = 0;
+			/// @brief Sleeps until the framebuffer has a non-zero size (e.g. the window is restored from minimized), the window closes
+			///     or the timeout (nanoseconds) expires. Returns true if the framebuffer has a non-zero size.
+			bool WaitFrameBufferSize(uint64_t timeout = UINT64_MAX) {
+				std::unique_lock<std::mutex> guard(frameBufferLock);
+				auto sized = [this]() { return (hwndWidth > 0 && hwndHeight > 0) || !ShouldExecute(); };
 
-				while (width <= 0 || height <= 0)
-					glfwGetFramebufferSize(hwndWindow, &width, &height);
+				if (timeout == UINT64_MAX) {
+					frameBufferResized.wait(guard, sized);
+				} else { frameBufferResized.wait_for(guard, std::chrono::nanoseconds(timeout), sized); }
+				return hwndWidth > 0 && hwndHeight > 0;
+			}
 
-				hwndWidth = width;
-				hwndHeight = height;
+			/// @brief Pass to render engine for swapchain resizing (blocks without spinning while the framebuffer has zero size).
+			void OnFrameBufferReSizeCallback(int& width, int& height) {
+				WaitFrameBufferSize();
+				std::lock_guard<std::mutex> guard(frameBufferLock);
+				width = hwndWidth;
+				height = hwndHeight;
 			}
 			
 			/// @brief Checks if the GLFW window should continue executing (true) or close (false).
@@ -99,6 +117,10 @@
 					if (eventType == TinyWindowEvents::POLL_EVENTS)
 					{ glfwPollEvents(); } else { glfwWaitEvents(); }
 				}
+
+				// Wake render threads sleeping in WaitFrameBufferSize (e.g. closed while minimized).
+				std::lock_guard<std::mutex> guard(frameBufferLock);
+				frameBufferResized.notify_all();
 			}
 			
 			/// @brief Explicitly set bordered/gullscreen mode.
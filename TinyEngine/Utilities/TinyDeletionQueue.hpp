@@ -0,0 +1,94 @@
+#pragma once
+#ifndef TINY_ENGINE_TINYDELETIONQUEUE
+#define TINY_ENGINE_TINYDELETIONQUEUE
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Deferred GPU resource destruction keyed on the render graph's frame timeline (owned by TinyVkDevice).
+		///
+		///     Resources released (disposed with waitIdle) while frame N is pending are destroyed once the frame timeline
+		///     reaches N + 1 (the last submit of frame N signals it), instead of stalling the device with vkDeviceWaitIdle.
+		///     Without an attached frame timeline (no render graph) releases fall back to waiting on the device and destroying immediately.
+		class TinyDeletionQueue {
+		public:
+			struct TinyDeletion {
+			public:
+				uint64_t frameValue;
+				TinyDelegate<> destroy;
+			};
+
+			const TinyDeviceFunctions* functions = VK_NULL_HANDLE;
+			VkDevice device = VK_NULL_HANDLE;
+			VkSemaphore frameTimeline = VK_NULL_HANDLE;
+			std::atomic_uint64_t pendingValue = 0;
+
+			std::mutex queueLock;
+			std::vector<TinyDeletion> deletions;
+
+			TinyDeletionQueue operator=(const TinyDeletionQueue&) = delete;
+			TinyDeletionQueue(const TinyDeletionQueue&) = delete;
+			TinyDeletionQueue() = default;
+
+			/// @brief Attaches the frame timeline semaphore (frame N signals N + 1) releases are deferred on.
+			void Attach(const TinyDeviceFunctions& functions, VkDevice device, VkSemaphore frameTimeline, uint64_t pendingValue) {
+				this->functions = &functions;
+				this->device = device;
+				this->frameTimeline = frameTimeline;
+				this->pendingValue = pendingValue;
+			}
+
+			/// @brief Destroys every queued resource and detaches the frame timeline (call before destroying the semaphore).
+			void Detach() {
+				Flush();
+				frameTimeline = VK_NULL_HANDLE;
+			}
+
+			/// @brief Sets the frame timeline value releases are deferred until (frame N pending: N + 1).
+			void BeginFrame(uint64_t frameValue) { pendingValue = frameValue; }
+
+			/// @brief Queues a resource destruction until the pending frame completes. Destroys immediately if waitIdle is false
+			///     (the caller guarantees the resource is unused) or no frame timeline is attached (waits on the device first).
+			void Push(TinyDelegate<> destroy, bool waitIdle = true) {
+				if (waitIdle && frameTimeline != VK_NULL_HANDLE) {
+					std::lock_guard<std::mutex> guard(queueLock);
+					deletions.push_back({ pendingValue.load(), std::move(destroy) });
+					return;
+				}
+
+				if (waitIdle && device != VK_NULL_HANDLE) vkDeviceWaitIdle(device);
+				destroy();
+			}
+
+			/// @brief Destroys every queued resource whose frame the GPU has completed (non-blocking), returns the number destroyed.
+			size_t Collect() {
+				if (frameTimeline == VK_NULL_HANDLE) return 0;
+				uint64_t completedValue = 0;
+				if (vkGetSemaphoreCounterValueEKHR(*functions, device, frameTimeline, &completedValue) != VK_SUCCESS) return 0;
+
+				std::vector<TinyDeletion> completed;
+				{
+					std::lock_guard<std::mutex> guard(queueLock);
+					auto pending = std::stable_partition(deletions.begin(), deletions.end(), [completedValue](const TinyDeletion& deletion) { return deletion.frameValue > completedValue; });
+					std::move(pending, deletions.end(), std::back_inserter(completed));
+					deletions.erase(pending, deletions.end());
+				}
+
+				// Destroyed outside of the lock, destructors may release (push) further resources.
+				for(TinyDeletion& deletion : completed) deletion.destroy();
+				return completed.size();
+			}
+
+			/// @brief Waits on the device and destroys every queued resource (teardown).
+			void Flush() {
+				std::vector<TinyDeletion> completed;
+				{
+					std::lock_guard<std::mutex> guard(queueLock);
+					completed.swap(deletions);
+				}
+
+				if (completed.size() > 0 && device != VK_NULL_HANDLE) vkDeviceWaitIdle(device);
+				for(TinyDeletion& deletion : completed) deletion.destroy();
+			}
+		};
+	}
+#endif
@@ -25,6 +25,10 @@
 			TYPE_IMAGE_SAMPLER = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
 			/// @brief Read-Only buffer type for shader samplers.
 			TYPE_UNIFORM_BUFFER = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+			/// @brief Read-Write buffer type (SSBO) for shader storage.
+			TYPE_STORAGE_BUFFER = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			/// @brief Read-Write image type (imageLoad/imageStore) in LAYOUT_GENERAL, no sampler.
+			TYPE_STORAGE_IMAGE = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
 		};
 
 		/// Descriptor binding indices/values.
@@ -49,10 +53,16 @@
 			TYPE_INDEX,
 			/// @brief For passing uniform/shader variable data to shaders.
 			TYPE_UNIFORM,
+			/// @brief Persistently mapped (host written, no staging) uniform data, e.g. TinyUniformRing per-draw blocks.
+			TYPE_UNIFORM_MAPPED,
 			/// @brief For writing VkIndirectCommand's to a buffer for Indirect drawing.
 			TYPE_INDIRECT,
+			/// @brief For read-write (SSBO) shader storage, e.g. GPU culling or particle data.
+			TYPE_STORAGE,
 			/// @brief For tranfering CPU bound buffer data to the GPU.
-			TYPE_STAGING
+			TYPE_STAGING,
+			/// @brief For copying GPU results back to the CPU (host cached, see TinyReadbackRing).
+			TYPE_READBACK
 		};
 
 		/// @brief Image-Layout for rendering operations.
@@ -80,7 +90,9 @@
 			/// @brief For writing to VkImage via Fragment shaders.
 			TYPE_COLORATTACHMENT,
 			/// @brief For reading within shaders only.
-			TYPE_SHADER_READONLY
+			TYPE_SHADER_READONLY,
+			/// @brief For read-write (imageLoad/imageStore) access in shaders, kept in LAYOUT_GENERAL.
+			TYPE_STORAGE
 		};
 
 		/// @brief Window/Present Buffering Frequency.
@@ -95,6 +107,40 @@
 			MODE_QUADRUPLE = 4
 		};
 
+		/// @brief Swapchain frame pacing (see TinyRenderGraph::PaceFrame).
+		enum class TinyFramePacing {
+			/// @brief Frames are only paced by the frame fence & swapchain acquire (highest throughput, finished frames may queue up behind vsync).
+			PACING_THROUGHPUT,
+			/// @brief Frames (and input sampling in render events) start as late as possible before presenting:
+			///     waits on the previous present with VK_KHR_present_wait, otherwise throttles the CPU by the measured blocking time.
+			PACING_LOW_LATENCY
+		};
+
+		/// @brief Image file formats decoded by TinyImageLoader (PNG requires TINY_ENGINE_PNG).
+		enum class TinyImageFileFormat {
+			FORMAT_UNKNOWN,
+			FORMAT_QOI,
+			FORMAT_PNG,
+			/// @brief KTX2 containers of GPU formats (e.g. BC7/ASTC) with mip chains, without supercompression.
+			FORMAT_KTX2
+		};
+
+		/// @brief Residency state of a texture streamed by TinyTextureStreamer.
+		enum class TinyTextureState {
+			/// @brief Waiting for a decode thread and staging memory.
+			STATE_QUEUED,
+			/// @brief Decoding on the thread pool into staging memory.
+			STATE_DECODING,
+			/// @brief Decoded into staging memory, waiting for upload budget.
+			STATE_DECODED,
+			/// @brief Uploaded to its image (usable from the uploading frame's later passes).
+			STATE_RESIDENT,
+			/// @brief Evicted (unused and over the memory budget), queued again on the next Acquire.
+			STATE_EVICTED,
+			/// @brief The file couldn't be mapped/decoded or doesn't fit the staging memory.
+			STATE_FAILED
+		};
+
 		/// @brief Command-Buffer submit-stage for specifying "when," we get be doing certain things during rendering: e.g. change image layouts.
 		enum class TinyCmdBufferSubmitStage {
 			/// @brief Pre-Render & Pre-Pipeline-Access & Pipeline-Acess submit stage.
@@ -104,6 +150,38 @@
 			/// @brief No-Pipeline-Access submit stage (for layout transitions).
 			STAGE_BEGIN_TO_END
 		};
+
+		/// @brief Declared image/buffer access for render pass resource tracking (see TinyResourceTracker).
+		enum class TinyResourceUsage {
+			/// @brief Copy source (LAYOUT_TRANSFER_SRC for images).
+			USAGE_TRANSFER_READ,
+			/// @brief Copy destination (LAYOUT_TRANSFER_DST for images).
+			USAGE_TRANSFER_WRITE,
+			/// @brief Vertex buffer reads.
+			USAGE_VERTEX_BUFFER,
+			/// @brief Index buffer reads.
+			USAGE_INDEX_BUFFER,
+			/// @brief Indirect draw command/count reads.
+			USAGE_INDIRECT_BUFFER,
+			/// @brief Uniform buffer reads from vertex/fragment shaders.
+			USAGE_UNIFORM_READ,
+			/// @brief Sampled image reads from vertex/fragment shaders (LAYOUT_SHADER_READONLY).
+			USAGE_SHADER_READ,
+			/// @brief Sampled image reads from fragment shaders only (LAYOUT_SHADER_READONLY).
+			USAGE_FRAGMENT_READ,
+			/// @brief Storage buffer/image reads from vertex/fragment shaders (LAYOUT_GENERAL).
+			USAGE_STORAGE_READ,
+			/// @brief Storage buffer/image writes from vertex/fragment shaders (LAYOUT_GENERAL).
+			USAGE_STORAGE_WRITE,
+			/// @brief Storage buffer/image reads and writes from vertex/fragment shaders (LAYOUT_GENERAL).
+			USAGE_STORAGE_READ_WRITE,
+			/// @brief Render target reads/writes (LAYOUT_COLOR_ATTACHMENT).
+			USAGE_COLOR_ATTACHMENT,
+			/// @brief Swapchain presentation (LAYOUT_PRESENT_SRC).
+			USAGE_PRESENT,
+			/// @brief CPU reads of mapped memory after GPU writes (buffers only).
+			USAGE_HOST_READ
+		};
 		
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
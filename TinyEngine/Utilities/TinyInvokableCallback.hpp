@@ -7,75 +7,302 @@
     #include <functional>
     #include <vector>
     #include <mutex>
+    #include <atomic>
+    #include <algorithm>
+    #include <cstdint>
+    #include <new>
+    #include <type_traits>
+    #include <cstddef>
     #include <utility>
 
     namespace TINY_ENGINE_NAMESPACE {
+        #ifndef TINY_ENGINE_DELEGATE_SIZE
+            /// @brief Inline capture storage (bytes) of TinyDelegate, larger callables fall back to one heap allocation.
+            #define TINY_ENGINE_DELEGATE_SIZE 48
+        #endif
+
+        /// @brief Small-buffer-optimized callable (std::function replacement): callables up to TINY_ENGINE_DELEGATE_SIZE bytes
+        ///     (e.g. lambdas capturing a few references/pointers) are stored inline without heap allocation and invoked through
+        ///     a single function pointer. Larger or throwing-move callables are heap allocated.
+        template<typename... A>
+        class TinyDelegate {
+        private:
+            enum class Operation { OP_COPY, OP_MOVE, OP_DESTROY };
+            using Invoker = void(*)(void*, A...);
+            using Manager = void(*)(Operation, void*, void*);
+
+            alignas(std::max_align_t) unsigned char storage[TINY_ENGINE_DELEGATE_SIZE];
+            Invoker invoker = nullptr;
+            Manager manager = nullptr;
+
+            template<typename F>
+            static constexpr bool IsInline = sizeof(F) <= TINY_ENGINE_DELEGATE_SIZE && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+            template<typename F, typename G>
+            void Bind(G&& func) {
+                static_assert(std::is_copy_constructible_v<F>, "TinyDelegate callables must be copy constructible.");
+                if constexpr (IsInline<F>) {
+                    new (storage) F(std::forward<G>(func));
+                    invoker = [](void* target, A... args) { (*static_cast<F*>(target))(std::forward<A>(args)...); };
+                    manager = [](Operation op, void* dst, void* src) {
+                        switch(op) {
+                            case Operation::OP_COPY: new (dst) F(*static_cast<const F*>(src)); break;
+                            case Operation::OP_MOVE: new (dst) F(std::move(*static_cast<F*>(src))); static_cast<F*>(src)->~F(); break;
+                            case Operation::OP_DESTROY: static_cast<F*>(dst)->~F(); break;
+                        }
+                    };
+                } else {
+                    new (storage) F*(new F(std::forward<G>(func)));
+                    invoker = [](void* target, A... args) { (**static_cast<F**>(target))(std::forward<A>(args)...); };
+                    manager = [](Operation op, void* dst, void* src) {
+                        switch(op) {
+                            case Operation::OP_COPY: new (dst) F*(new F(**static_cast<F**>(src))); break;
+                            case Operation::OP_MOVE: new (dst) F*(*static_cast<F**>(src)); break;
+                            case Operation::OP_DESTROY: delete *static_cast<F**>(dst); break;
+                        }
+                    };
+                }
+            }
+
+            void Reset() {
+                if (manager != nullptr) manager(Operation::OP_DESTROY, storage, nullptr);
+                invoker = nullptr;
+                manager = nullptr;
+            }
+
+        public:
+            TinyDelegate() = default;
+            ~TinyDelegate() { Reset(); }
+
+            template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, TinyDelegate<A...>> && std::is_invocable_v<std::decay_t<F>&, A...>>>
+            TinyDelegate(F&& func) { Bind<std::decay_t<F>>(std::forward<F>(func)); }
+
+            TinyDelegate(const TinyDelegate<A...>& other) : invoker(other.invoker), manager(other.manager) {
+                if (manager != nullptr) manager(Operation::OP_COPY, storage, const_cast<unsigned char*>(other.storage));
+            }
+
+            TinyDelegate(TinyDelegate<A...>&& other) noexcept : invoker(other.invoker), manager(other.manager) {
+                if (manager != nullptr) manager(Operation::OP_MOVE, storage, other.storage);
+                other.invoker = nullptr;
+                other.manager = nullptr;
+            }
+
+            TinyDelegate<A...>& operator=(const TinyDelegate<A...>& other) {
+                if (this != &other) { TinyDelegate<A...> copy(other); *this = std::move(copy); }
+                return *this;
+            }
+
+            TinyDelegate<A...>& operator=(TinyDelegate<A...>&& other) noexcept {
+                if (this == &other) return *this;
+                Reset();
+                invoker = other.invoker;
+                manager = other.manager;
+                if (manager != nullptr) manager(Operation::OP_MOVE, storage, other.storage);
+                other.invoker = nullptr;
+                other.manager = nullptr;
+                return *this;
+            }
+
+            /// @brief Returns true if the delegate is bound to a callable.
+            explicit operator bool() const { return invoker != nullptr; }
+
+            /// @brief Invokes the bound callable (no-op if unbound).
+            void operator()(A... args) const { if (invoker != nullptr) invoker(const_cast<unsigned char*>(storage), std::forward<A>(args)...); }
+        };
+
         /// @brief Function callback-type for event execution.
         template<typename... A>
         class TinyCallback {
         public:
-            /// @brief Unique identifying hash code.
+            /// @brief Unique handle (per constructed callback, shared by its copies) for hook/unhook.
             size_t hash;
             /// @brief The function bound to this TinyCallback.
-            std::function<void(A...)> bound;
+            TinyDelegate<A...> bound;
+
+            /// @brief Returns a new unique callback handle (0 is never returned).
+            static size_t NextHandle() {
+                static std::atomic_size_t handleCounter = 0;
+                return ++handleCounter;
+            }
             
             /// @brief Create a new TinyCallback with the specified arguments.
-            TinyCallback(std::function<void(A...)> func) : hash(func.target_type().hash_code()), bound(std::move(func)) {}
+            template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, TinyCallback<A...>> && std::is_invocable_v<std::decay_t<F>&, A...>>>
+            TinyCallback(F&& func) : hash(NextHandle()), bound(std::forward<F>(func)) {}
 
-            /// @brief @brief Compares the underlying hash_code of the TinyCallback function(s) for uniqueness.
-            bool compare(const TinyCallback<A...>& cb) { return hash == cb.hash; }
+            /// @brief @brief Compares the unique handles of the TinyCallback function(s).
+            bool compare(const TinyCallback<A...>& cb) const { return hash == cb.hash; }
 
-            /// @brief Returns the unique hash code for this TinyCallback function.
+            /// @brief Returns the unique handle for this TinyCallback function.
             constexpr size_t hash_code() const throw() { return hash; }
 
             /// @brief Invoke this TinyCallback with required arguments.
-            TinyCallback<A...>& invoke(A... args) { bound(static_cast<A&&>(args)...); return (*this); }
+            TinyCallback<A...>& invoke(A... args) { bound(std::forward<A>(args)...); return (*this); }
+        };
+
+        /// @brief Epoch based reclamation for read-mostly (RCU) data. Readers announce the global epoch in their own cache line sized
+        ///     per-thread record for the duration of a read (no lock, no shared cache line written), writers unpublish replaced data,
+        ///     retire it tagged with the advanced epoch and free it once no reader still announces an older epoch.
+        class TinyEpoch {
+        public:
+            struct alignas(64) Record {
+            public:
+                /// @brief Epoch announced by the owning thread while reading, 0 while not reading.
+                std::atomic_uint64_t epoch = 0;
+                std::atomic_bool inUse = false;
+                Record* next = nullptr;
+            };
+
+            /// @brief The calling thread's record (released for re-use when the thread exits) and read nesting depth.
+            struct ThreadRecord {
+            public:
+                Record* record = nullptr;
+                uint32_t depth = 0;
+                ~ThreadRecord() { if (record != nullptr) record->inUse.store(false, std::memory_order_release); }
+            };
+
+            /// @brief Scoped read section (nestable), data loaded within it stays valid until the guard is destroyed.
+            class ReadGuard {
+            public:
+                ReadGuard() { TinyEpoch::Enter(); }
+                ~ReadGuard() { TinyEpoch::Exit(); }
+                ReadGuard(const ReadGuard&) = delete;
+                ReadGuard& operator=(const ReadGuard&) = delete;
+            };
+
+            inline static std::atomic_uint64_t globalEpoch = 1;
+            /// @brief Push-only list of thread records (never freed, bounded by the peak number of concurrently reading threads).
+            inline static std::atomic<Record*> records = nullptr;
+
+            static Record* AcquireRecord() {
+                for(Record* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+                    bool expected = false;
+                    if (!record->inUse.load(std::memory_order_relaxed) && record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) return record;
+                }
+
+                Record* record = new Record();
+                record->inUse.store(true, std::memory_order_relaxed);
+                record->next = records.load(std::memory_order_relaxed);
+                while(!records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed));
+                return record;
+            }
+
+            static ThreadRecord& Local() {
+                thread_local ThreadRecord local;
+                if (local.record == nullptr) local.record = AcquireRecord();
+                return local;
+            }
+
+            /// @brief Enters a read section, only the outermost section of nested reads announces the epoch.
+            static void Enter() {
+                ThreadRecord& local = Local();
+                if (local.depth++ == 0) local.record->epoch.store(globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
+
+            static void Exit() {
+                ThreadRecord& local = Local();
+                if (--local.depth == 0) local.record->epoch.store(0, std::memory_order_release);
+            }
+
+            /// @brief Advances the epoch after data was unpublished, returns the epoch to retire the data with.
+            static uint64_t Advance() { return globalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1; }
+
+            /// @brief Returns the oldest epoch announced by a reader (UINT64_MAX if none), data retired at or before it can be freed.
+            static uint64_t OldestReader() {
+                uint64_t oldest = UINT64_MAX;
+                for(Record* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+                    uint64_t epoch = record->epoch.load(std::memory_order_seq_cst);
+                    if (epoch != 0) oldest = std::min(oldest, epoch);
+                }
+                return oldest;
+            }
         };
 
         /// @brief Function-List event invoking/executing (takes TinyCallback).
+        ///
+        ///     Copy-on-write callback list: invoke() enters a TinyEpoch read section, loads the current immutable snapshot (atomic raw
+        ///     pointer) and calls every callback by reference (no lock, no allocation, no copies, no shared refcount, never dropped).
+        ///     hook/unhook/empty are serialized by a mutex and publish a new snapshot, replaced snapshots are freed once no invoke can
+        ///     still read them, so callbacks may (un)hook from within an invoke (applies to the next invoke).
         template<typename... A>
         class TinyInvokable {
         public:
-            /// @brief Resource lock for thread-safe accessibility.
-            std::timed_mutex safety_lock;
-            /// @brief Record of stored TinyCallback(s) to invoke.
-            std::vector<TinyCallback<A...>> callbacks;
+            using CallbackList = std::vector<TinyCallback<A...>>;
+
+            /// @brief Serializes writers (hook/unhook/empty), readers never take it.
+            std::mutex safety_lock;
+            /// @brief Immutable snapshot of stored TinyCallback(s) to invoke.
+            std::atomic<const CallbackList*> callbacks = new CallbackList();
+            /// @brief Replaced snapshots and the epoch they were retired with (writers only, under safety_lock).
+            std::vector<std::pair<const CallbackList*, uint64_t>> retired;
+
+            TinyInvokable() = default;
+            TinyInvokable(const TinyInvokable<A...>&) = delete;
+            TinyInvokable<A...>& operator=(const TinyInvokable<A...>&) = delete;
+
+            /// @brief No invoke may be in progress on a destroyed event.
+            ~TinyInvokable() {
+                delete callbacks.load(std::memory_order_relaxed);
+                for(std::pair<const CallbackList*, uint64_t>& snapshot : retired) delete snapshot.first;
+            }
+
+            /// @brief Replaces the snapshot (caller holds safety_lock), retires the old one and frees retired snapshots no reader can hold.
+            void publish(const CallbackList* updated) {
+                const CallbackList* replaced = callbacks.exchange(updated, std::memory_order_seq_cst);
+                retired.push_back({ replaced, TinyEpoch::Advance() });
+
+                uint64_t oldestReader = TinyEpoch::OldestReader();
+                std::erase_if(retired, [oldestReader](const std::pair<const CallbackList*, uint64_t>& snapshot) {
+                    if (snapshot.second > oldestReader) return false;
+                    delete snapshot.first;
+                    return true;
+                });
+            }
 
             /// brief Clones this event's callbacks into another event with the same parameters.
-            void clone(TinyInvokable<A...> invokable) {
-                invokable.callbackk = this->callbacks;
+            void clone(TinyInvokable<A...>& invokable) {
+                CallbackList* updated;
+                {
+                    TinyEpoch::ReadGuard guard;
+                    updated = new CallbackList(*callbacks.load(std::memory_order_seq_cst));
+                }
+                std::lock_guard<std::mutex> g(invokable.safety_lock);
+                invokable.publish(updated);
             }
             
             /// @brief Adds a TinyCallback to this event, operator +=
-            bool hook(const TinyCallback<A...> cb) {
-                TinyTimedGuard<> g(safety_lock);
-                bool signaled = g.signaled();
-                if (signaled) callbacks.push_back(cb);
-                return signaled;
+            bool hook(const TinyCallback<A...>& cb) {
+                std::lock_guard<std::mutex> g(safety_lock);
+                CallbackList* updated = new CallbackList(*callbacks.load(std::memory_order_relaxed));
+                updated->push_back(cb);
+                publish(updated);
+                return true;
             }
 
             /// @brief Removes a TinyCallback from this event.
-            bool unhook(const TinyCallback<A...> cb) {
-                TinyTimedGuard<> g(safety_lock);
-                bool signaled = g.signaled();
-                if (signaled) std::erase_if(callbacks, [cb](TinyCallback<A...> c){ return cb.hash_code() == c.hash_code(); });
-                return signaled;
+            bool unhook(const TinyCallback<A...>& cb) { return unhook(cb.hash_code()); }
+            
+            /// @brief Removes the TinyCallback with the handle (TinyCallback::hash_code) from this event.
+            bool unhook(size_t handle) {
+                std::lock_guard<std::mutex> g(safety_lock);
+                CallbackList* updated = new CallbackList(*callbacks.load(std::memory_order_relaxed));
+                std::erase_if(*updated, [handle](const TinyCallback<A...>& c){ return c.hash_code() == handle; });
+                publish(updated);
+                return true;
             }
             
             /// @brief Removes all registered TinyCallback from this event.
             bool empty(const TinyCallback<A...> cb) {
-                TinyTimedGuard<> g(safety_lock);
-                bool signaled = g.signaled();
-                if (signaled) callbacks.clear();
-                return signaled;
+                std::lock_guard<std::mutex> g(safety_lock);
+                publish(new CallbackList());
+                return true;
             }
 
-            /// @brief Execute all registered TinyCallbacks (signals locking until all callbacks return).
+            /// @brief Execute all registered TinyCallbacks (on the snapshot taken at the start of the call).
             bool invoke(A... args) {
-                TinyTimedGuard<> g(safety_lock);
-                bool signaled = g.signaled();
-                if (signaled) for (TinyCallback<A...> cb : callbacks) cb.invoke(static_cast<A&&>(args)...);
-                return signaled;
+                TinyEpoch::ReadGuard guard;
+                const CallbackList* snapshot = callbacks.load(std::memory_order_seq_cst);
+                for (const TinyCallback<A...>& cb : *snapshot) cb.bound(args...);
+                return true;
             }
         };
     }
@@ -0,0 +1,76 @@
+#pragma once
+#ifndef TINY_ENGINE_TINYMAPPEDFILE
+#define TINY_ENGINE_TINYMAPPEDFILE
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Read-only memory mapped file (asset loading without reading the file into an intermediate heap buffer).
+		///     The mapping is released on destruction, check IsOpen() after construction.
+		class TinyMappedFile {
+		private:
+			#if defined (_WIN32)
+				HANDLE fileHandle = INVALID_HANDLE_VALUE;
+				HANDLE mappingHandle = NULL;
+			#endif
+
+			void Close() {
+				#if defined (_WIN32)
+					if (data != nullptr) UnmapViewOfFile(data);
+					if (mappingHandle != NULL) CloseHandle(mappingHandle);
+					if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+					mappingHandle = NULL;
+					fileHandle = INVALID_HANDLE_VALUE;
+				#else
+					if (data != nullptr) munmap(const_cast<uint8_t*>(data), size);
+				#endif
+				data = nullptr;
+				size = 0;
+			}
+
+		public:
+			const uint8_t* data = nullptr;
+			size_t size = 0;
+
+			TinyMappedFile operator=(const TinyMappedFile&) = delete;
+			TinyMappedFile(const TinyMappedFile&) = delete;
+			~TinyMappedFile() { Close(); }
+
+			/// @brief Maps the whole file read-only (empty files and files that can't be opened leave IsOpen() false).
+			TinyMappedFile(const std::string& path) {
+				#if defined (_WIN32)
+					fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+					LARGE_INTEGER fileSize = {};
+
+					if (fileHandle != INVALID_HANDLE_VALUE && GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0) {
+						mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+						if (mappingHandle != NULL) data = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+					}
+
+					if (data != nullptr) { size = static_cast<size_t>(fileSize.QuadPart); } else { Close(); }
+				#else
+					int fileHandle = open(path.c_str(), O_RDONLY);
+					struct stat fileStat;
+
+					if (fileHandle >= 0 && fstat(fileHandle, &fileStat) == 0 && fileStat.st_size > 0) {
+						void* mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileHandle, 0);
+						if (mapping != MAP_FAILED) {
+							data = static_cast<const uint8_t*>(mapping);
+							size = static_cast<size_t>(fileStat.st_size);
+							madvise(mapping, size, MADV_SEQUENTIAL);
+						}
+					}
+
+					// The mapping stays valid after the file descriptor is closed.
+					if (fileHandle >= 0) close(fileHandle);
+				#endif
+
+				#if TINY_ENGINE_VALIDATION
+					if (data == nullptr) std::cout << "TinyEngine: Failed to map file: " << path << std::endl;
+				#endif
+			}
+
+			/// @brief Returns true if the file is mapped (data/size are valid).
+			bool IsOpen() { return data != nullptr; }
+		};
+	}
+#endif
\ No newline at end of file
@@ -0,0 +1,215 @@
+#pragma once
+#ifndef TINY_ENGINE_TINYPIXELCONVERTER
+#define TINY_ENGINE_TINYPIXELCONVERTER
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Converts 8-bit RGBA/BGRA pixels (UNORM/SRGB) to an image format while writing into staging memory, the kernel is
+		///     picked once from the source/destination formats: copy, R/B swizzle, 16-bit expansion and alpha premultiply (SSE2 with
+		///     a scalar fallback), sRGB encoding changes run a scalar lookup table kernel. Destinations: R8G8B8A8/B8G8R8A8 UNORM/SRGB
+		///     and R16G16B16A16_UNORM. Premultiplying sRGB pixels is done in linear space.
+		class TinyPixelConverter {
+		private:
+			using Kernel = void(*)(const TinyPixelConverter&, const uint8_t*, uint8_t*, size_t);
+			Kernel kernel = nullptr;
+
+			static bool QueryBGRA(VkFormat format) { return format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8A8_SRGB; }
+			static bool QuerySRGB(VkFormat format) { return format == VK_FORMAT_R8G8B8A8_SRGB || format == VK_FORMAT_B8G8R8A8_SRGB; }
+
+			static uint32_t Swizzle(uint32_t px) { return (px & 0xFF00FF00) | ((px >> 16) & 0xFF) | ((px & 0xFF) << 16); }
+			static uint32_t Premultiply(uint32_t color, uint32_t alpha) { uint32_t product = color * alpha + 128; return (product + (product >> 8)) >> 8; }
+
+			/// @brief sRGB 8-bit to linear 16-bit.
+			static const std::array<uint16_t, 256>& LinearTable() {
+				static const std::array<uint16_t, 256> table = []() {
+					std::array<uint16_t, 256> values;
+					for(size_t i = 0; i < 256; i++) {
+						double c = i / 255.0;
+						values[i] = static_cast<uint16_t>(((c <= 0.04045)? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4)) * 65535.0 + 0.5);
+					}
+					return values;
+				}();
+				return table;
+			}
+
+			/// @brief Linear 16-bit (upper 12 bits) to sRGB 8-bit.
+			static const std::array<uint8_t, 4096>& SRGBTable() {
+				static const std::array<uint8_t, 4096> table = []() {
+					std::array<uint8_t, 4096> values;
+					for(size_t i = 0; i < 4096; i++) {
+						double c = (i * 16 + 8) / 65535.0;
+						values[i] = static_cast<uint8_t>(((c <= 0.0031308)? c * 12.92 : 1.055 * std::pow(c, 1.0 / 2.4) - 0.055) * 255.0 + 0.5);
+					}
+					return values;
+				}();
+				return table;
+			}
+
+			static void KernelCopy(const TinyPixelConverter& converter, const uint8_t* source, uint8_t* dest, size_t pixelCount) {
+				memmove(dest, source, pixelCount * 4);
+			}
+
+			static void KernelSwizzle(const TinyPixelConverter& converter, const uint8_t* source, uint8_t* dest, size_t pixelCount) {
+				size_t i = 0;
+				#if TINY_ENGINE_SIMD
+					const __m128i greenAlpha = _mm_set1_epi32(static_cast<int>(0xFF00FF00)), red = _mm_set1_epi32(0xFF);
+					for(; i + 4 <= pixelCount; i += 4) {
+						__m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+						px = _mm_or_si128(_mm_and_si128(px, greenAlpha), _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px, 16), red), _mm_slli_epi32(_mm_and_si128(px, red), 16)));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 4), px);
+					}
+				#endif
+
+				for(uint32_t px; i < pixelCount; i++) {
+					memcpy(&px, source + i * 4, 4);
+					px = Swizzle(px);
+					memcpy(dest + i * 4, &px, 4);
+				}
+			}
+
+			static void KernelExpand16(const TinyPixelConverter& converter, const uint8_t* source, uint8_t* dest, size_t pixelCount) {
+				size_t i = 0;
+				#if TINY_ENGINE_SIMD
+					const __m128i greenAlpha = _mm_set1_epi32(static_cast<int>(0xFF00FF00)), red = _mm_set1_epi32(0xFF);
+					for(; i + 4 <= pixelCount; i += 4) {
+						__m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+						if (converter.swizzle) px = _mm_or_si128(_mm_and_si128(px, greenAlpha), _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px, 16), red), _mm_slli_epi32(_mm_and_si128(px, red), 16)));
+						// Interleaving each byte with itself is the exact UNORM8 -> UNORM16 conversion (c * 257).
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 8), _mm_unpacklo_epi8(px, px));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 8 + 16), _mm_unpackhi_epi8(px, px));
+					}
+				#endif
+
+				for(; i < pixelCount; i++) {
+					uint32_t px;
+					memcpy(&px, source + i * 4, 4);
+					if (converter.swizzle) px = Swizzle(px);
+					uint16_t channels[4] = { static_cast<uint16_t>((px & 0xFF) * 257), static_cast<uint16_t>(((px >> 8) & 0xFF) * 257), static_cast<uint16_t>(((px >> 16) & 0xFF) * 257), static_cast<uint16_t>((px >> 24) * 257) };
+					memcpy(dest + i * 8, channels, 8);
+				}
+			}
+
+			static void KernelPremultiply(const TinyPixelConverter& converter, const uint8_t* source, uint8_t* dest, size_t pixelCount) {
+				size_t i = 0;
+				#if TINY_ENGINE_SIMD
+					const __m128i greenAlpha = _mm_set1_epi32(static_cast<int>(0xFF00FF00)), red = _mm_set1_epi32(0xFF), zero = _mm_setzero_si128();
+					const __m128i colorLanes = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1), alphaLanes = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0), rounding = _mm_set1_epi16(128);
+
+					for(; i + 4 <= pixelCount; i += 4) {
+						__m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+						if (converter.swizzle) px = _mm_or_si128(_mm_and_si128(px, greenAlpha), _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px, 16), red), _mm_slli_epi32(_mm_and_si128(px, red), 16)));
+
+						// Two pixels per register as 16-bit lanes, the alpha lane is multiplied by 255 (unchanged after the division).
+						__m128i halves[2] = { _mm_unpacklo_epi8(px, zero), _mm_unpackhi_epi8(px, zero) };
+						for(__m128i& half : halves) {
+							__m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(half, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+							__m128i product = _mm_add_epi16(_mm_mullo_epi16(half, _mm_or_si128(_mm_and_si128(alpha, colorLanes), alphaLanes)), rounding);
+							half = _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+						}
+
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 4), _mm_packus_epi16(halves[0], halves[1]));
+					}
+				#endif
+
+				for(; i < pixelCount; i++) {
+					uint32_t px;
+					memcpy(&px, source + i * 4, 4);
+					if (converter.swizzle) px = Swizzle(px);
+					uint32_t alpha = px >> 24;
+					px = Premultiply(px & 0xFF, alpha) | (Premultiply((px >> 8) & 0xFF, alpha) << 8) | (Premultiply((px >> 16) & 0xFF, alpha) << 16) | (alpha << 24);
+					memcpy(dest + i * 4, &px, 4);
+				}
+			}
+
+			/// @brief Any conversion through linear 16-bit color: sRGB decoding, premultiply, sRGB encoding (scalar, lookup tables).
+			static void KernelGeneral(const TinyPixelConverter& converter, const uint8_t* source, uint8_t* dest, size_t pixelCount) {
+				const uint16_t* linearTable = LinearTable().data();
+				const uint8_t* srgbTable = SRGBTable().data();
+				// Copied to locals, writes through dest (uint8_t) may alias the converter.
+				const size_t red = (QueryBGRA(converter.sourceFormat))? 2 : 0, blue = 2 - red;
+				const size_t destRed = (QueryBGRA(converter.destFormat))? 2 : 0, destBlue = 2 - destRed;
+				const bool decodeSRGB = converter.decodeSRGB, encodeSRGB = converter.encodeSRGB, premultiply = converter.premultiply, dest16 = converter.destBytes == 8;
+
+				for(size_t i = 0; i < pixelCount; i++) {
+					const uint8_t* px = source + i * 4;
+					uint32_t alpha = px[3], channels[3] = { px[red], px[1], px[blue] };
+
+					for(size_t c = 0; c < 3; c++) {
+						channels[c] = (decodeSRGB)? linearTable[channels[c]] : channels[c] * 257;
+						if (premultiply) channels[c] = (channels[c] * alpha + 127) / 255;
+					}
+
+					if (dest16) {
+						uint16_t values[4] = { static_cast<uint16_t>(channels[0]), static_cast<uint16_t>(channels[1]), static_cast<uint16_t>(channels[2]), static_cast<uint16_t>(alpha * 257) };
+						memcpy(dest + i * 8, values, 8);
+					} else {
+						uint8_t values[4];
+						values[destRed] = (encodeSRGB)? srgbTable[channels[0] >> 4] : static_cast<uint8_t>((channels[0] + 128) / 257);
+						values[1] = (encodeSRGB)? srgbTable[channels[1] >> 4] : static_cast<uint8_t>((channels[1] + 128) / 257);
+						values[destBlue] = (encodeSRGB)? srgbTable[channels[2] >> 4] : static_cast<uint8_t>((channels[2] + 128) / 257);
+						values[3] = static_cast<uint8_t>(alpha);
+						memcpy(dest + i * 4, values, 4);
+					}
+				}
+			}
+
+		public:
+			VkFormat sourceFormat, destFormat;
+			bool premultiply;
+			/// @brief Swaps red/blue (RGBA <-> BGRA).
+			bool swizzle = false;
+			/// @brief sRGB source decoded to linear (destination isn't sRGB or premultiplying in linear space).
+			bool decodeSRGB = false;
+			/// @brief Linear color encoded to sRGB (sRGB destination from linear color or premultiplied sRGB).
+			bool encodeSRGB = false;
+			/// @brief Bytes per source/destination pixel (destBytes 0 if the conversion isn't supported).
+			uint32_t sourceBytes = 4, destBytes = 0;
+
+			/// @brief Picks the conversion kernel, check Supported() for unsupported format pairs.
+			TinyPixelConverter(VkFormat sourceFormat = VK_FORMAT_R8G8B8A8_UNORM, VkFormat destFormat = VK_FORMAT_R8G8B8A8_UNORM, bool premultiply = false)
+			: sourceFormat(sourceFormat), destFormat(destFormat), premultiply(premultiply) {
+				bool source8 = sourceFormat == VK_FORMAT_R8G8B8A8_UNORM || sourceFormat == VK_FORMAT_R8G8B8A8_SRGB || QueryBGRA(sourceFormat);
+				bool dest8 = destFormat == VK_FORMAT_R8G8B8A8_UNORM || destFormat == VK_FORMAT_R8G8B8A8_SRGB || QueryBGRA(destFormat);
+				bool dest16 = destFormat == VK_FORMAT_R16G16B16A16_UNORM;
+				if (!source8 || (!dest8 && !dest16)) return;
+
+				destBytes = (dest16)? 8 : 4;
+				swizzle = QueryBGRA(sourceFormat) != QueryBGRA(destFormat);
+				decodeSRGB = QuerySRGB(sourceFormat) && (!QuerySRGB(destFormat) || premultiply);
+				encodeSRGB = QuerySRGB(destFormat) && (!QuerySRGB(sourceFormat) || premultiply);
+
+				if (decodeSRGB || encodeSRGB) {
+					kernel = KernelGeneral;
+				} else if (dest16) {
+					kernel = (premultiply)? KernelGeneral : KernelExpand16;
+				} else if (premultiply) {
+					kernel = KernelPremultiply;
+				} else {
+					kernel = (swizzle)? KernelSwizzle : KernelCopy;
+				}
+			}
+
+			/// @brief Returns true if the source/destination formats can be converted.
+			bool Supported() const { return kernel != nullptr; }
+
+			/// @brief Returns true if the conversion is a plain copy.
+			bool Identity() const { return kernel == KernelCopy; }
+
+			/// @brief Converts pixelCount pixels from source into dest (may be the same memory for 4-byte destinations).
+			void Convert(const void* source, void* dest, size_t pixelCount) const {
+				if (kernel != nullptr) kernel(*this, static_cast<const uint8_t*>(source), static_cast<uint8_t*>(dest), pixelCount);
+			}
+
+			/// @brief Converts pixelCount pixels split into batches across the thread pool and the calling thread.
+			void Convert(const void* source, void* dest, size_t pixelCount, TinyThreadPool* pool, size_t batchPixels = 65536) const {
+				size_t batches = (pixelCount + batchPixels - 1) / batchPixels;
+				if (pool == nullptr || batches < 2) { Convert(source, dest, pixelCount); return; }
+
+				pool->ParallelFor(batches, [this, source, dest, pixelCount, batchPixels](size_t batch) {
+					size_t first = batch * batchPixels;
+					Convert(static_cast<const uint8_t*>(source) + first * sourceBytes, static_cast<uint8_t*>(dest) + first * destBytes, std::min(batchPixels, pixelCount - first));
+				});
+			}
+		};
+	}
+#endif
\ No newline at end of file
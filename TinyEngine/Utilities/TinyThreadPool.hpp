@@ -0,0 +1,102 @@
+#pragma once
+#ifndef TINY_ENGINE_TINYTHREADPOOL
+#define TINY_ENGINE_TINYTHREADPOOL
+	#include "./TinyEngine.hpp"
+
+	namespace TINY_ENGINE_NAMESPACE {
+		/// @brief Fixed set of worker threads for CPU side work (asset decoding, streaming) off of the render thread.
+		class TinyThreadPool {
+		private:
+			std::mutex queueLock;
+			std::condition_variable queueSignal;
+			std::vector<TinyDelegate<>> tasks;
+			std::vector<std::thread> workers;
+			bool running = true;
+
+			void Worker() {
+				while(true) {
+					TinyDelegate<> task;
+					{
+						std::unique_lock<std::mutex> guard(queueLock);
+						queueSignal.wait(guard, [this]() { return !running || tasks.size() > 0; });
+						if (tasks.size() == 0) return;
+						task = std::move(tasks.back());
+						tasks.pop_back();
+					}
+					task();
+				}
+			}
+
+		public:
+			TinyThreadPool operator=(const TinyThreadPool&) = delete;
+			TinyThreadPool(const TinyThreadPool&) = delete;
+
+			/// @brief Joins all worker threads (remaining queued tasks are executed first).
+			~TinyThreadPool() {
+				{
+					std::lock_guard<std::mutex> guard(queueLock);
+					running = false;
+				}
+
+				queueSignal.notify_all();
+				for(std::thread& worker : workers) worker.join();
+			}
+
+			/// @brief Creates the worker threads, 0 threads uses one per hardware thread less the calling thread.
+			TinyThreadPool(size_t threadCount = 0) {
+				if (threadCount == 0) threadCount = std::max<size_t>(1, std::thread::hardware_concurrency()) - 1;
+				for(size_t i = 0; i < threadCount; i++) workers.emplace_back([this]() { Worker(); });
+			}
+
+			/// @brief Returns the number of worker threads (excluding callers participating in ParallelFor).
+			size_t WorkerCount() { return workers.size(); }
+
+			/// @brief Queues a task to be executed on a worker thread (executed on the calling thread if the pool has no workers).
+			void Enqueue(TinyDelegate<> task) {
+				if (workers.size() == 0) { task(); return; }
+				{
+					std::lock_guard<std::mutex> guard(queueLock);
+					tasks.push_back(std::move(task));
+				}
+				queueSignal.notify_one();
+			}
+
+			/// @brief Executes task(index) for every index in [0, count) across the workers and the calling thread, returns once all complete.
+			void ParallelFor(size_t count, TinyDelegate<size_t> task) {
+				if (count == 0) return;
+
+				struct TinyParallelState {
+					TinyDelegate<size_t> task;
+					size_t count;
+					std::atomic_size_t next = 0;
+					std::atomic_size_t remaining = 0;
+					std::mutex completeLock;
+					std::condition_variable completeSignal;
+				};
+
+				// Shared state (not the caller's stack), helpers may only start after every index is complete and ParallelFor returned.
+				std::shared_ptr<TinyParallelState> state = std::make_shared<TinyParallelState>();
+				state->task = std::move(task);
+				state->count = count;
+				state->remaining = count;
+
+				auto execute = [state]() {
+					for(size_t index = state->next++; index < state->count; index = state->next++) {
+						state->task(index);
+						if (--state->remaining == 0) {
+							std::lock_guard<std::mutex> guard(state->completeLock);
+							state->completeSignal.notify_all();
+						}
+					}
+				};
+
+				size_t helpers = std::min(workers.size(), count - 1);
+				for(size_t i = 0; i < helpers; i++) Enqueue(execute);
+				execute();
+
+				std::unique_lock<std::mutex> guard(state->completeLock);
+				state->completeSignal.wait(guard, [&state]() { return state->remaining.load() == 0; });
+			}
+		};
+	}
+#endif
\ No newline at end of file
@@ -38,68 +38,222 @@
 		#pragma endregion
 		#pragma region VULKAN_DYNAMIC_RENDERING_FUNCTIONS
 
-		PFN_vkCmdBeginRenderingKHR vkCmdBeginRenderingEXTKHR = VK_NULL_HANDLE;
-		PFN_vkCmdEndRenderingKHR vkCmdEndRenderingEXTKHR = VK_NULL_HANDLE;
-		PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetEXTKHR = VK_NULL_HANDLE;
-		
-		VkResult vkCmdRenderingGetCallbacks(VkInstance instance) {
-			vkCmdBeginRenderingEXTKHR = (PFN_vkCmdBeginRenderingKHR)vkGetInstanceProcAddr(instance, "vkCmdBeginRenderingKHR");
-			vkCmdEndRenderingEXTKHR = (PFN_vkCmdEndRenderingKHR)vkGetInstanceProcAddr(instance, "vkCmdEndRenderingKHR");
-			vkCmdPushDescriptorSetEXTKHR = (PFN_vkCmdPushDescriptorSetKHR)vkGetInstanceProcAddr(instance, "vkCmdPushDescriptorSetKHR");
-			
-			if (vkCmdBeginRenderingEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
-			if (vkCmdEndRenderingEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
-			if (vkCmdPushDescriptorSetEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
-			return VK_SUCCESS;
-		}
+		/// @brief Extension function pointers of one logical device (owned by TinyVkDevice, loaded with vkGetDeviceProcAddr so
+		///     each device dispatches straight to its own driver), passed as the first argument of the vk...EKHR wrappers.
+		struct TinyDeviceFunctions {
+		public:
+			PFN_vkCmdBeginRenderingKHR vkCmdBeginRenderingEXTKHR = VK_NULL_HANDLE;
+			PFN_vkCmdEndRenderingKHR vkCmdEndRenderingEXTKHR = VK_NULL_HANDLE;
+			PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetEXTKHR = VK_NULL_HANDLE;
+			PFN_vkCmdDrawIndirectCountKHR vkCmdDrawIndirectCountEXTKHR = VK_NULL_HANDLE;
+			PFN_vkCmdDrawIndexedIndirectCountKHR vkCmdDrawIndexedIndirectCountEXTKHR = VK_NULL_HANDLE;
+			PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2EXTKHR = VK_NULL_HANDLE;
+			PFN_vkQueueSubmit2KHR vkQueueSubmit2EXTKHR = VK_NULL_HANDLE;
+			PFN_vkWaitForPresentKHR vkWaitForPresentEXTKHR = VK_NULL_HANDLE;
+			PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueEXTKHR = VK_NULL_HANDLE;
+			PFN_vkWaitSemaphoresKHR vkWaitSemaphoresEXTKHR = VK_NULL_HANDLE;
+
+			/// @brief Loads the functions of the logical device, fails if a required (non-optional) extension function is missing.
+			VkResult Load(VkDevice device) {
+				vkCmdBeginRenderingEXTKHR = (PFN_vkCmdBeginRenderingKHR)vkGetDeviceProcAddr(device, "vkCmdBeginRenderingKHR");
+				vkCmdEndRenderingEXTKHR = (PFN_vkCmdEndRenderingKHR)vkGetDeviceProcAddr(device, "vkCmdEndRenderingKHR");
+				vkCmdPushDescriptorSetEXTKHR = (PFN_vkCmdPushDescriptorSetKHR)vkGetDeviceProcAddr(device, "vkCmdPushDescriptorSetKHR");
+				vkCmdDrawIndirectCountEXTKHR = (PFN_vkCmdDrawIndirectCountKHR)vkGetDeviceProcAddr(device, "vkCmdDrawIndirectCountKHR");
+				vkCmdDrawIndexedIndirectCountEXTKHR = (PFN_vkCmdDrawIndexedIndirectCountKHR)vkGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirectCountKHR");
+				vkCmdPipelineBarrier2EXTKHR = (PFN_vkCmdPipelineBarrier2KHR)vkGetDeviceProcAddr(device, "vkCmdPipelineBarrier2KHR");
+				vkQueueSubmit2EXTKHR = (PFN_vkQueueSubmit2KHR)vkGetDeviceProcAddr(device, "vkQueueSubmit2KHR");
+				vkWaitForPresentEXTKHR = (PFN_vkWaitForPresentKHR)vkGetDeviceProcAddr(device, "vkWaitForPresentKHR");
+				vkGetSemaphoreCounterValueEXTKHR = (PFN_vkGetSemaphoreCounterValueKHR)vkGetDeviceProcAddr(device, "vkGetSemaphoreCounterValueKHR");
+				vkWaitSemaphoresEXTKHR = (PFN_vkWaitSemaphoresKHR)vkGetDeviceProcAddr(device, "vkWaitSemaphoresKHR");
+
+				if (vkCmdBeginRenderingEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
+				if (vkCmdEndRenderingEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
+				if (vkCmdPushDescriptorSetEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
+				if (vkCmdPipelineBarrier2EXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
+				if (vkQueueSubmit2EXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
+				if (vkGetSemaphoreCounterValueEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
+				if (vkWaitSemaphoresEXTKHR == VK_NULL_HANDLE) return VK_ERROR_FEATURE_NOT_PRESENT;
+				return VK_SUCCESS;
+			}
+		};
 
-		VkResult vkCmdBeginRenderingEKHR(VkInstance instance, VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
-			if (vkCmdBeginRenderingEXTKHR == VK_NULL_HANDLE) {
+		VkResult vkCmdBeginRenderingEKHR(const TinyDeviceFunctions& functions, VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
+			if (functions.vkCmdBeginRenderingEXTKHR == VK_NULL_HANDLE) {
 				#if TINY_ENGINE_VALIDATION
 						std::cout << "TinyEngine: Failed to load VK_KHR_dynamic_rendering EXT function: PFN_vkCmdBeginRenderingKHR" << std::endl;
 				#endif
 				return VK_ERROR_INITIALIZATION_FAILED;
 			}
 
-			vkCmdBeginRenderingEXTKHR(commandBuffer, pRenderingInfo);
+			functions.vkCmdBeginRenderingEXTKHR(commandBuffer, pRenderingInfo);
 			return VK_SUCCESS;
 		}
 
-		VkResult vkCmdEndRenderingEKHR(VkInstance instance, VkCommandBuffer commandBuffer) {
-			if (vkCmdEndRenderingEXTKHR == VK_NULL_HANDLE) {
+		VkResult vkCmdEndRenderingEKHR(const TinyDeviceFunctions& functions, VkCommandBuffer commandBuffer) {
+			if (functions.vkCmdEndRenderingEXTKHR == VK_NULL_HANDLE) {
 				#if TINY_ENGINE_VALIDATION
 						std::cout << "TinyEngine: Failed to load VK_KHR_dynamic_rendering EXT function: PFN_vkCmdEndRenderingKHR" << std::endl;
 				#endif
 				return VK_ERROR_INITIALIZATION_FAILED;
 			}
 
-			vkCmdEndRenderingEXTKHR(commandBuffer);
+			functions.vkCmdEndRenderingEXTKHR(commandBuffer);
 			return VK_SUCCESS;
 		}
 
-		VkResult vkCmdPushDescriptorSetEKHR(VkInstance instance, VkCommandBuffer commandBuffer, VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t set, uint32_t writeCount, const VkWriteDescriptorSet* pWriteSets) {
-			if (vkCmdPushDescriptorSetEXTKHR == VK_NULL_HANDLE) {
+		VkResult vkCmdPushDescriptorSetEKHR(const TinyDeviceFunctions& functions, VkCommandBuffer commandBuffer, VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t set, uint32_t writeCount, const VkWriteDescriptorSet* pWriteSets) {
+			if (functions.vkCmdPushDescriptorSetEXTKHR == VK_NULL_HANDLE) {
 				#if TINY_ENGINE_VALIDATION
 					std::cout << "TinyEngine: Failed to load VK_KHR_dynamic_rendering EXT function: PFN_vkCmdPushDescriptorSetKHR" << std::endl;
 				#endif
 				return VK_ERROR_INITIALIZATION_FAILED;
 			}
 
-			vkCmdPushDescriptorSetEXTKHR(commandBuffer, bindPoint, layout, set, writeCount, pWriteSets);
+			functions.vkCmdPushDescriptorSetEXTKHR(commandBuffer, bindPoint, layout, set, writeCount, pWriteSets);
 			return VK_SUCCESS;
 		}
 
+		VkResult vkCmdDrawIndirectCountEKHR(const TinyDeviceFunctions& functions, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+			if (functions.vkCmdDrawIndirectCountEXTKHR == VK_NULL_HANDLE) {
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Failed to load VK_KHR_draw_indirect_count EXT function: PFN_vkCmdDrawIndirectCountKHR" << std::endl;
+				#endif
+				return VK_ERROR_FEATURE_NOT_PRESENT;
+			}
+
+			functions.vkCmdDrawIndirectCountEXTKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+			return VK_SUCCESS;
+		}
+
+		VkResult vkCmdDrawIndexedIndirectCountEKHR(const TinyDeviceFunctions& functions, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+			if (functions.vkCmdDrawIndexedIndirectCountEXTKHR == VK_NULL_HANDLE) {
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Failed to load VK_KHR_draw_indirect_count EXT function: PFN_vkCmdDrawIndexedIndirectCountKHR" << std::endl;
+				#endif
+				return VK_ERROR_FEATURE_NOT_PRESENT;
+			}
+
+			functions.vkCmdDrawIndexedIndirectCountEXTKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+			return VK_SUCCESS;
+		}
+
+		VkResult vkCmdPipelineBarrier2EKHR(const TinyDeviceFunctions& functions, VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
+			if (functions.vkCmdPipelineBarrier2EXTKHR == VK_NULL_HANDLE) {
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Failed to load VK_KHR_synchronization2 EXT function: PFN_vkCmdPipelineBarrier2KHR" << std::endl;
+				#endif
+				return VK_ERROR_FEATURE_NOT_PRESENT;
+			}
+
+			functions.vkCmdPipelineBarrier2EXTKHR(commandBuffer, pDependencyInfo);
+			return VK_SUCCESS;
+		}
+
+		VkResult vkQueueSubmit2EKHR(const TinyDeviceFunctions& functions, VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+			if (functions.vkQueueSubmit2EXTKHR == VK_NULL_HANDLE) {
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Failed to load VK_KHR_synchronization2 EXT function: PFN_vkQueueSubmit2KHR" << std::endl;
+				#endif
+				return VK_ERROR_FEATURE_NOT_PRESENT;
+			}
+
+			return functions.vkQueueSubmit2EXTKHR(queue, submitCount, pSubmits, fence);
+		}
+
+		VkResult vkGetSemaphoreCounterValueEKHR(const TinyDeviceFunctions& functions, VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
+			if (functions.vkGetSemaphoreCounterValueEXTKHR == VK_NULL_HANDLE) {
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Failed to load VK_KHR_timeline_semaphore EXT function: PFN_vkGetSemaphoreCounterValueKHR" << std::endl;
+				#endif
+				return VK_ERROR_FEATURE_NOT_PRESENT;
+			}
+
+			return functions.vkGetSemaphoreCounterValueEXTKHR(device, semaphore, pValue);
+		}
+
+		VkResult vkWaitSemaphoresEKHR(const TinyDeviceFunctions& functions, VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+			if (functions.vkWaitSemaphoresEXTKHR == VK_NULL_HANDLE) {
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Failed to load VK_KHR_timeline_semaphore EXT function: PFN_vkWaitSemaphoresKHR" << std::endl;
+				#endif
+				return VK_ERROR_FEATURE_NOT_PRESENT;
+			}
+
+			return functions.vkWaitSemaphoresEXTKHR(device, pWaitInfo, timeout);
+		}
+
+		VkResult vkWaitForPresentEKHR(const TinyDeviceFunctions& functions, VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) {
+			if (functions.vkWaitForPresentEXTKHR == VK_NULL_HANDLE) {
+				#if TINY_ENGINE_VALIDATION
+					std::cout << "TinyEngine: Failed to load VK_KHR_present_wait EXT function: PFN_vkWaitForPresentKHR" << std::endl;
+				#endif
+				return VK_ERROR_FEATURE_NOT_PRESENT;
+			}
+
+			return functions.vkWaitForPresentEXTKHR(device, swapchain, presentId, timeout);
+		}
+
 		#pragma endregion
         #pragma region VULKAN_INTERFACE SUPPORT
 
 		/// @brief Vulkan Queue Family flags.
 		struct TinyQueueFamily {
-			uint32_t graphicsFamily, presentFamily;
-			bool hasGraphicsFamily, hasPresentFamily;
+			uint32_t graphicsFamily, presentFamily, transferFamily;
+			bool hasGraphicsFamily, hasPresentFamily, hasTransferFamily;
+			/// @brief Timestamp valid bits of the graphics family (0 if timestamp queries are unsupported).
+			uint32_t timestampValidBits;
 
-			TinyQueueFamily() : graphicsFamily(0), presentFamily(0), hasGraphicsFamily(false), hasPresentFamily(false) {}
+			TinyQueueFamily() : graphicsFamily(0), presentFamily(0), transferFamily(0), hasGraphicsFamily(false), hasPresentFamily(false), hasTransferFamily(false), timestampValidBits(0) {}
 			void SetGraphicsFamily(uint32_t queueFamily) { graphicsFamily = queueFamily; hasGraphicsFamily = true; }
 			void SetPresentFamily(uint32_t queueFamily) { presentFamily = queueFamily; hasPresentFamily = true; }
+			void SetTransferFamily(uint32_t queueFamily) { transferFamily = queueFamily; hasTransferFamily = true; }
+
+			/// @brief True if transfers have their own (DMA) queue family without graphics/compute, otherwise transferFamily is the graphics family.
+			bool DedicatedTransfer() const { return hasTransferFamily && hasGraphicsFamily && transferFamily != graphicsFamily; }
+		};
+
+		/// @brief Physical device selection for TinyVkDevice: devices must support the device extensions (dynamic rendering, push descriptors, ...)
+		///     and a graphics queue family (presenting to the window surface if any), the highest scoring device is selected.
+		///
+		///     Scores are tiered: device type (preferredType first, then discrete, integrated, virtual, CPU) << 48, dedicated transfer queue << 40,
+		///     graphics queue timestamps << 36, plus the device-local heap size in MB, plus userScore. Overrides (deviceIndex, deviceName) select
+		///     a device directly if it meets the requirements, e.g. to open one TinyVkDevice per GPU for split workloads.
+		struct TinyDeviceSelector {
+		public:
+			/// @brief Selects the device at this vkEnumeratePhysicalDevices index (-1 for scored selection).
+			int32_t deviceIndex = -1;
+			/// @brief Selects the first device whose name contains deviceName (empty for scored selection).
+			std::string deviceName = "";
+			/// @brief Device type scored highest, e.g. VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU for headless offscreen work beside a discrete present device.
+			VkPhysicalDeviceType preferredType = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
+			bool preferDedicatedTransfer = true;
+			/// @brief Optional score added to the capability score, a negative score rejects the device.
+			std::function<int64_t(VkPhysicalDevice)> userScore = nullptr;
+		};
+
+		/// @brief Last GPU access of a tracked image/buffer (see TinyResourceTracker).
+		struct TinyResourceState {
+		public:
+			/// @brief Stages/accesses of the last write (or layout transition) every later access must wait on.
+			VkPipelineStageFlags2 writeStages = VK_PIPELINE_STAGE_2_NONE;
+			VkAccessFlags2 writeAccess = VK_ACCESS_2_NONE;
+			/// @brief Stages/accesses which have read since (and already see) the last write.
+			VkPipelineStageFlags2 readStages = VK_PIPELINE_STAGE_2_NONE;
+			VkAccessFlags2 readAccess = VK_ACCESS_2_NONE;
+
+			static constexpr VkAccessFlags2 writeAccessMask = VK_ACCESS_2_SHADER_WRITE_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+				| VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_HOST_WRITE_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+			static bool IsWriteAccess(VkAccessFlags2 access) { return (access & writeAccessMask) != 0; }
+
+			/// @brief Records an access that was synchronized by a barrier (write or layout transition) with dstStages/dstAccess.
+			void Synchronized(VkPipelineStageFlags2 dstStages, VkAccessFlags2 dstAccess) {
+				bool isWrite = IsWriteAccess(dstAccess);
+				writeStages = dstStages;
+				writeAccess = dstAccess & writeAccessMask;
+				readStages = (isWrite)? VK_PIPELINE_STAGE_2_NONE : dstStages;
+				readAccess = (isWrite)? VK_ACCESS_2_NONE : dstAccess;
+			}
 		};
 
 		/// @brief Description of the SwapChain Rendering format.
@@ -116,6 +270,7 @@
 			VkFormat dataFormat = VK_FORMAT_B8G8R8A8_UNORM;
 			VkColorSpaceKHR colorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
 			VkPresentModeKHR idealPresentMode = VK_PRESENT_MODE_FIFO_KHR;
+			TinyBufferingMode bufferingMode = TinyBufferingMode::MODE_DOUBLE;
 		};
 
         #pragma endregion
@@ -149,23 +304,132 @@
 			return VK_ERROR_DEVICE_LOST;
 		}
 
+		bool QueryDeviceExtensionSupport(VkPhysicalDevice device, const char* extensionName) {
+			uint32_t extensionCount = 0;
+			vkEnumerateDeviceExtensionProperties(device, VK_NULL_HANDLE, &extensionCount, VK_NULL_HANDLE);
+			std::vector<VkExtensionProperties> extensions(extensionCount);
+			vkEnumerateDeviceExtensionProperties(device, VK_NULL_HANDLE, &extensionCount, extensions.data());
+
+			for(const VkExtensionProperties& extension : extensions)
+				if (std::string(extension.extensionName) == extensionName) return true;
+			return false;
+		}
+
+		/// @brief Gets the graphics family (which also presents to presentSurface if not VK_NULL_HANDLE, preferring timestamp support)
+		///     and the transfer family (a dedicated transfer-only family if available, otherwise the graphics family).
 		TinyQueueFamily QueryPhysicalDeviceQueueFamilies(VkPhysicalDevice device, VkSurfaceKHR presentSurface) {
 			TinyQueueFamily indices = {};
 			if (device != VK_NULL_HANDLE) {
 				std::vector<VkQueueFamilyProperties> queueFamilies;
 				QueryQueueFamilyProperties(device, queueFamilies);
 				for (int i = 0; i < queueFamilies.size(); i++) {
-					VkBool32 presentSupport = false;
-					vkGetPhysicalDeviceSurfaceSupportKHR(device, i, presentSurface, &presentSupport);
-					if (!indices.hasGraphicsFamily && !indices.hasPresentFamily && presentSupport && queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT && queueFamilies[i].timestampValidBits) {
-						indices.SetGraphicsFamily(i);
-						indices.SetPresentFamily(i);
-					}
+					VkBool32 presentSupport = (presentSurface == VK_NULL_HANDLE);
+					if (presentSurface != VK_NULL_HANDLE) vkGetPhysicalDeviceSurfaceSupportKHR(device, i, presentSurface, &presentSupport);
+					if (!presentSupport || !(queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)) continue;
+					if (indices.hasGraphicsFamily && (indices.timestampValidBits > 0 || queueFamilies[i].timestampValidBits == 0)) continue;
+
+					indices.SetGraphicsFamily(i);
+					indices.timestampValidBits = queueFamilies[i].timestampValidBits;
+					if (presentSurface != VK_NULL_HANDLE) indices.SetPresentFamily(i);
 				}
+
+				for (int i = 0; i < queueFamilies.size(); i++)
+					if ((queueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) && !(queueFamilies[i].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+						indices.SetTransferFamily(i);
+						break;
+					}
+
+				if (!indices.hasTransferFamily && indices.hasGraphicsFamily) indices.SetTransferFamily(indices.graphicsFamily);
 			}
 			return indices;
 		}
 
+		/// @brief Scores the physical device for selection (see TinyDeviceSelector), -1 if it lacks a required extension or queue family.
+		int64_t QueryPhysicalDeviceScore(VkPhysicalDevice device, VkSurfaceKHR presentSurface, const std::vector<const char*>& deviceExtensions, const TinyDeviceSelector& selector) {
+			for(const char* extension : deviceExtensions)
+				if (!QueryDeviceExtensionSupport(device, extension)) return -1;
+
+			TinyQueueFamily queueFamilies = QueryPhysicalDeviceQueueFamilies(device, presentSurface);
+			if (!queueFamilies.hasGraphicsFamily) return -1;
+
+			VkPhysicalDeviceProperties properties {};
+			vkGetPhysicalDeviceProperties(device, &properties);
+			int64_t typeScore = 0;
+			if (properties.deviceType == selector.preferredType) typeScore = 4;
+			else if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU) typeScore = 3;
+			else if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU) typeScore = 2;
+			else if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU) typeScore = 1;
+
+			int64_t score = (typeScore << 48) + (static_cast<int64_t>(selector.preferDedicatedTransfer && queueFamilies.DedicatedTransfer()) << 40)
+				+ (static_cast<int64_t>(queueFamilies.timestampValidBits > 0) << 36) + std::min<int64_t>(QueryPhysicalDeviceRankByHeapSize(device) / 1048576, (1LL << 36) - 1);
+
+			if (selector.userScore == nullptr) return score;
+			int64_t userScore = selector.userScore(device);
+			return (userScore < 0)? -1 : score + userScore;
+		}
+
+		#pragma endregion
+		#pragma region VULKAN_FORMAT_HELPER_FUNCTIONS
+
+		/// @brief Texel block of an image format: block extent in texels and bytes per block (1x1 blocks for uncompressed formats).
+		struct TinyFormatBlock {
+		public:
+			uint32_t width = 1, height = 1;
+			uint32_t bytes = 0;
+		};
+
+		/// @brief Returns the texel block of common color formats, block-compressed (BC1-7) and ASTC formats (bytes 0 if unknown).
+		TinyFormatBlock QueryFormatBlock(VkFormat format) {
+			if (format >= VK_FORMAT_ASTC_4x4_UNORM_BLOCK && format <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK) {
+				const uint32_t astcBlocks[14][2] = { {4,4}, {5,4}, {5,5}, {6,5}, {6,6}, {8,5}, {8,6}, {8,8}, {10,5}, {10,6}, {10,8}, {10,10}, {12,10}, {12,12} };
+				const uint32_t* extent = astcBlocks[(format - VK_FORMAT_ASTC_4x4_UNORM_BLOCK) / 2];
+				return { extent[0], extent[1], 16 };
+			}
+
+			switch(format) {
+				case VK_FORMAT_BC1_RGB_UNORM_BLOCK: case VK_FORMAT_BC1_RGB_SRGB_BLOCK: case VK_FORMAT_BC1_RGBA_UNORM_BLOCK: case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+				case VK_FORMAT_BC4_UNORM_BLOCK: case VK_FORMAT_BC4_SNORM_BLOCK:
+					return { 4, 4, 8 };
+				case VK_FORMAT_BC2_UNORM_BLOCK: case VK_FORMAT_BC2_SRGB_BLOCK: case VK_FORMAT_BC3_UNORM_BLOCK: case VK_FORMAT_BC3_SRGB_BLOCK:
+				case VK_FORMAT_BC5_UNORM_BLOCK: case VK_FORMAT_BC5_SNORM_BLOCK: case VK_FORMAT_BC6H_UFLOAT_BLOCK: case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+				case VK_FORMAT_BC7_UNORM_BLOCK: case VK_FORMAT_BC7_SRGB_BLOCK:
+					return { 4, 4, 16 };
+				case VK_FORMAT_R8_UNORM: case VK_FORMAT_R8_SRGB:
+					return { 1, 1, 1 };
+				case VK_FORMAT_R8G8_UNORM: case VK_FORMAT_R16_UNORM: case VK_FORMAT_R16_SFLOAT:
+					return { 1, 1, 2 };
+				case VK_FORMAT_R8G8B8A8_UNORM: case VK_FORMAT_R8G8B8A8_SRGB: case VK_FORMAT_B8G8R8A8_UNORM: case VK_FORMAT_B8G8R8A8_SRGB:
+				case VK_FORMAT_A2B10G10R10_UNORM_PACK32: case VK_FORMAT_B10G11R11_UFLOAT_PACK32: case VK_FORMAT_R16G16_UNORM: case VK_FORMAT_R16G16_SFLOAT:
+				case VK_FORMAT_R32_SFLOAT: case VK_FORMAT_R32_UINT: case VK_FORMAT_D32_SFLOAT:
+					return { 1, 1, 4 };
+				case VK_FORMAT_R16G16B16A16_UNORM: case VK_FORMAT_R16G16B16A16_SFLOAT: case VK_FORMAT_R32G32_SFLOAT:
+					return { 1, 1, 8 };
+				case VK_FORMAT_R32G32B32A32_SFLOAT:
+					return { 1, 1, 16 };
+				default:
+					return { 1, 1, 0 };
+			}
+		}
+
+		/// @brief Returns true for block-compressed (BCn/ASTC) formats, which can only be sampled or copied (not rendered to/stored).
+		bool QueryFormatCompressed(VkFormat format) {
+			TinyFormatBlock block = QueryFormatBlock(format);
+			return block.width > 1 || block.height > 1;
+		}
+
+		/// @brief Returns the tightly packed byte size of one image (mip) level of width x height texels (partial blocks round up).
+		VkDeviceSize QueryFormatLevelSize(VkFormat format, VkDeviceSize width, VkDeviceSize height) {
+			TinyFormatBlock block = QueryFormatBlock(format);
+			return ((std::max<VkDeviceSize>(1, width) + block.width - 1) / block.width) * ((std::max<VkDeviceSize>(1, height) + block.height - 1) / block.height) * block.bytes;
+		}
+
+		/// @brief Returns the number of mip levels of a full mip chain down to 1x1.
+		uint32_t QueryFullMipLevels(VkDeviceSize width, VkDeviceSize height) {
+			uint32_t levels = 1;
+			for(VkDeviceSize extent = std::max(width, height); extent > 1; extent >>= 1) levels++;
+			return levels;
+		}
+
 		#pragma endregion
 		#pragma region VULKAN_DEFAULT_PIPELINE_STATES
 		
@@ -186,9 +450,39 @@
 			.pEngineName = TINY_ENGINE_NAME
 		};
 		
+		const VkPhysicalDevicePresentIdFeaturesKHR defaultPresentIdFeatures {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+			.presentId = VK_TRUE
+		};
+
+		const VkPhysicalDevicePresentWaitFeaturesKHR defaultPresentWaitFeatures {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+			.presentWait = VK_TRUE
+		};
+
+		const VkPhysicalDeviceSynchronization2FeaturesKHR defaultSynchronization2Features {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR,
+			.synchronization2 = VK_TRUE
+		};
+
+		const VkPhysicalDeviceDescriptorIndexingFeatures defaultDescriptorIndexingFeatures {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES,
+			.pNext = const_cast<VkPhysicalDeviceSynchronization2FeaturesKHR*>(&defaultSynchronization2Features),
+			.shaderSampledImageArrayNonUniformIndexing = VK_TRUE,
+			.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE,
+			.descriptorBindingUpdateUnusedWhilePending = VK_TRUE,
+			.descriptorBindingPartiallyBound = VK_TRUE,
+			.runtimeDescriptorArray = VK_TRUE
+		};
+
+		const VkPhysicalDeviceDescriptorIndexingProperties defaultDescriptorIndexingProperties {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES
+		};
+
 		const VkPhysicalDeviceTimelineSemaphoreFeatures defaultTimelineSemaphoreFeatures {
 			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
-			.timelineSemaphore = VK_TRUE
+			.timelineSemaphore = VK_TRUE,
+			.pNext = const_cast<VkPhysicalDeviceDescriptorIndexingFeatures*>(&defaultDescriptorIndexingFeatures)
 		};
 
 		const VkPhysicalDevicePushDescriptorPropertiesKHR defaultPushDescriptorProperties {
@@ -0,0 +1,63 @@
+#include "../TinyEngine/TinyEngine.hpp"
+using namespace tny;
+
+///
+/// Offline asset cooker: converts QOI/PNG images into GPU-ready KTX2 files (see TinyImageCooker), built with _COOKER.bat.
+///     cooker <input.qoi|.png> <output.ktx2> [format] [mips] [srgb]
+///         format: rgba8 (default), bgra8, bc1, bc1a, bc3
+///         mips:   0 (default) full mip chain, 1 no mip levels or N levels
+///         srgb:   srgb / unorm (default) encoding of the format
+/// Cooked files load with TinyImageLoader::LoadImage (copied straight from the mapped file into staging memory).
+///
+
+VkFormat QueryCookerFormat(const std::string& name, bool srgb) {
+    if (name == "rgba8") return (srgb)? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+    if (name == "bgra8") return (srgb)? VK_FORMAT_B8G8R8A8_SRGB : VK_FORMAT_B8G8R8A8_UNORM;
+    if (name == "bc1") return (srgb)? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+    if (name == "bc1a") return (srgb)? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+    if (name == "bc3") return (srgb)? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+    return VK_FORMAT_UNDEFINED;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cout << "Usage: cooker <input.qoi|.png> <output.ktx2> [rgba8|bgra8|bc1|bc1a|bc3] [mip levels, 0: full chain] [srgb|unorm]" << std::endl;
+        return 1;
+    }
+
+    bool srgb = argc > 5 && std::string(argv[5]) == "srgb";
+    VkFormat format = QueryCookerFormat((argc > 3)? argv[3] : "rgba8", srgb);
+    uint32_t mipLevels = (argc > 4)? static_cast<uint32_t>(std::stoul(argv[4])) : 0;
+
+    if (format == VK_FORMAT_UNDEFINED) {
+        std::cout << "Unknown format: " << argv[3] << std::endl;
+        return 1;
+    }
+
+    TinyMappedFile sourceFile(argv[1]);
+    TinyImageDescription description;
+    if (!TinyImageLoader::ReadHeader(sourceFile.data, sourceFile.size, description) || description.format != VK_FORMAT_R8G8B8A8_UNORM) {
+        std::cout << "Unsupported image file (QOI, or PNG with TINY_ENGINE_PNG): " << argv[1] << std::endl;
+        return 1;
+    }
+
+    TinyThreadPool threadPool;
+    std::vector<uint8_t> pixels(static_cast<size_t>(description.Sizeof(4)));
+    std::vector<uint8_t> cooked;
+
+    if (TinyImageLoader::Decode(sourceFile.data, sourceFile.size, description, pixels.data(), pixels.size(), 4, &threadPool) != VK_SUCCESS
+        || TinyImageCooker::CookKTX2(pixels.data(), description.width, description.height, format, mipLevels, cooked, &threadPool) != VK_SUCCESS) {
+        std::cout << "Failed to cook image: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    std::ofstream outputFile(argv[2], std::ios::binary);
+    outputFile.write(reinterpret_cast<const char*>(cooked.data()), static_cast<std::streamsize>(cooked.size()));
+    if (!outputFile) {
+        std::cout << "Failed to write: " << argv[2] << std::endl;
+        return 1;
+    }
+
+    std::cout << argv[1] << " (" << description.width << "x" << description.height << ") -> " << argv[2] << ": " << cooked.size() << " Bytes" << std::endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "../TinyEngine/TinyEngine.hpp"
+using namespace tny;
+
+///
+/// TinyInvokable microbenchmark: event dispatch cost of the epoch (RCU) snapshot TinyInvokable against the previous
+///     timed-mutex implementation (LegacyInvokable below), built with _BENCHMARK.bat.
+///     invokable_bench [invokes per thread] [threads]
+///         invokes: 2000000 (default) invokes per thread and run
+///         threads: hardware concurrency (default) for the contended runs
+/// Each run reports nanoseconds per invoke (wall time / invokes per thread). Contended runs invoke one shared event from every
+///     thread, the last one also hooks/unhooks a callback on it from an extra thread (reads should scale, the legacy lock serializes).
+///
+
+/// @brief The previous TinyInvokable: locks a timed mutex per invoke and copies every callback (and its std::function) by value.
+template<typename... A>
+class LegacyInvokable {
+public:
+    std::timed_mutex safety_lock;
+    std::vector<std::pair<size_t, std::function<void(A...)>>> callbacks;
+
+    bool hook(size_t handle, std::function<void(A...)> func) {
+        TinyTimedGuard<> g(safety_lock);
+        bool signaled = g.signaled();
+        if (signaled) callbacks.push_back({ handle, func });
+        return signaled;
+    }
+
+    bool unhook(size_t handle) {
+        TinyTimedGuard<> g(safety_lock);
+        bool signaled = g.signaled();
+        if (signaled) std::erase_if(callbacks, [handle](const std::pair<size_t, std::function<void(A...)>>& c) { return c.first == handle; });
+        return signaled;
+    }
+
+    bool invoke(A... args) {
+        TinyTimedGuard<> g(safety_lock);
+        bool signaled = g.signaled();
+        if (signaled) for (std::pair<size_t, std::function<void(A...)>> cb : callbacks) cb.second(args...);
+        return signaled;
+    }
+};
+
+/// @brief Stand-ins for the (TinyRenderPass&, TinyRenderObject&, bool) render event arguments.
+struct BenchPass { uint64_t counter = 0; };
+struct BenchObject { uint64_t counter = 0; };
+
+/// @brief Runs invoker(thread) invokes times on each of threadCount threads (with an optional concurrent writer), returns ns per invoke.
+template<typename Invoker, typename Writer>
+double MeasureInvokes(uint32_t threadCount, uint64_t invokes, Invoker invoker, Writer writer, bool contendWriter) {
+    std::atomic_bool running = true;
+    std::thread writerThread;
+    if (contendWriter) writerThread = std::thread([&running, &writer]() {
+        while(running.load(std::memory_order_relaxed)) { writer(); std::this_thread::sleep_for(std::chrono::microseconds(50)); }
+    });
+
+    std::vector<std::thread> threads;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(uint32_t t = 0; t < threadCount; t++)
+        threads.push_back(std::thread([&invoker, invokes]() { for(uint64_t i = 0; i < invokes; i++) invoker(); }));
+    for(std::thread& thread : threads) thread.join();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    running = false;
+    if (writerThread.joinable()) writerThread.join();
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(invokes);
+}
+
+/// @brief Benchmarks both events with callbackCount callbacks hooked.
+void BenchmarkEvents(uint32_t callbackCount, uint32_t threadCount, uint64_t invokes, bool contendWriter) {
+    TinyInvokable<BenchPass&, BenchObject&, bool> invokable;
+    LegacyInvokable<BenchPass&, BenchObject&, bool> legacy;
+    for(uint32_t i = 0; i < callbackCount; i++) {
+        TinyCallback<BenchPass&, BenchObject&, bool> callback([](BenchPass& pass, BenchObject& object, bool resized) { pass.counter += object.counter + resized; });
+        invokable.hook(callback);
+        legacy.hook(callback.hash_code(), [](BenchPass& pass, BenchObject& object, bool resized) { pass.counter += object.counter + resized; });
+    }
+
+    auto invokeTiny = [&invokable]() {
+        thread_local BenchPass pass; thread_local BenchObject object;
+        invokable.invoke(pass, object, false);
+    };
+    auto invokeLegacy = [&legacy]() {
+        thread_local BenchPass pass; thread_local BenchObject object;
+        legacy.invoke(pass, object, false);
+    };
+
+    TinyCallback<BenchPass&, BenchObject&, bool> churn([](BenchPass& pass, BenchObject& object, bool resized) {});
+    auto writeTiny = [&invokable, &churn]() { invokable.hook(churn); invokable.unhook(churn); };
+    auto writeLegacy = [&legacy, &churn]() { legacy.hook(churn.hash_code(), [](BenchPass&, BenchObject&, bool) {}); legacy.unhook(churn.hash_code()); };
+
+    double legacyTime = MeasureInvokes(threadCount, invokes, invokeLegacy, writeLegacy, contendWriter);
+    double tinyTime = MeasureInvokes(threadCount, invokes, invokeTiny, writeTiny, contendWriter);
+
+    std::cout << "  " << callbackCount << " callback(s), " << threadCount << " thread(s)" << ((contendWriter)? " + writer" : "")
+        << ": legacy " << legacyTime << " ns -> TinyInvokable " << tinyTime << " ns per invoke" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t invokes = (argc > 1)? std::stoull(argv[1]) : 2000000ULL;
+    uint32_t threadCount = (argc > 2)? static_cast<uint32_t>(std::stoul(argv[2])) : std::max(1U, std::thread::hardware_concurrency());
+
+    std::cout << "Uncontended (" << invokes << " invokes):" << std::endl;
+    BenchmarkEvents(1, 1, invokes, false);
+    BenchmarkEvents(4, 1, invokes, false);
+
+    std::cout << "Contended (" << invokes << " invokes per thread):" << std::endl;
+    BenchmarkEvents(1, threadCount, invokes, false);
+    BenchmarkEvents(4, threadCount, invokes, false);
+    BenchmarkEvents(4, threadCount, invokes, true);
+    return 0;
+}
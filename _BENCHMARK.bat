@@ -0,0 +1,29 @@
+::
+:: Builds the TinyInvokable microbenchmark (./Tools/invokable_bench.cpp), compares event dispatch against the previous timed-mutex implementation.
+::
+clang-cl^
+ /D _RELEASE_CONSOLE^
+ /D _CRT_SECURE_NO_WARNINGS^
+ /std:c++20^
+ /MP^
+ /MD^
+ /O2^
+ /Oi^
+ /GL^
+ /Gy^
+ /permissive^
+ /EHsc^
+ /W0^
+ /I "%CD%"^
+ /I "%GLFW%/include/"^
+ /I "%VULKAN%/Include/"^
+ /Fe:"%CD%/x64/BENCHMARK/"^
+ Tools/invokable_bench.cpp^
+ /link^
+ /opt:ref^
+ /subsystem:console^
+ shell32.lib^
+ gdi32.lib^
+ user32.lib^
+ "%GLFW%/lib-vc2022/glfw3.lib"^
+ "%VULKAN%/Lib/vulkan-1.lib"
@@ -0,0 +1,35 @@
+::
+:: Builds the offline asset cooker (./Tools/cooker.cpp), converts QOI/PNG images to GPU-ready KTX2 files.
+:: PNG support compiles libspng (./TinyEngine/Externals/spng.c) and links zlib from %ZLIB% (see buildtool.bat).
+::
+clang-cl^
+ /D _RELEASE_CONSOLE^
+ /D _CRT_SECURE_NO_WARNINGS^
+ /D TINY_ENGINE_PNG=1^
+ /D SPNG_STATIC^
+ /std:c++20^
+ /MP^
+ /MD^
+ /O2^
+ /Oi^
+ /GL^
+ /Gy^
+ /permissive^
+ /EHsc^
+ /W0^
+ /I "%CD%"^
+ /I "%GLFW%/include/"^
+ /I "%VULKAN%/Include/"^
+ /I "%ZLIB%/include/"^
+ /Fe:"%CD%/x64/COOKER/"^
+ Tools/cooker.cpp^
+ TinyEngine/Externals/spng.c^
+ /link^
+ /opt:ref^
+ /subsystem:console^
+ shell32.lib^
+ gdi32.lib^
+ user32.lib^
+ "%GLFW%/lib-vc2022/glfw3.lib"^
+ "%VULKAN%/Lib/vulkan-1.lib"^
+ "%ZLIB%/lib/zlib.lib"
@@ -5,4 +5,5 @@ SET INCLUDES=C:\lib-includes
 SET VULKAN=C:\VulkanSDK\1.3.290.0
 SET GLFW=C:\lib-includes\glfw-3.3.7.bin.WIN64\glfw-3.3.7.bin.WIN64
 SET VMA=C:\lib-includes\vmalib\include
+SET ZLIB=C:\lib-includes\zlib
 cmd.exe /k CLS
\ No newline at end of file
@@ -2,8 +2,6 @@
 using namespace tny;
 using namespace glm;
 
-#define QOI_IMPLEMENTATION
-#include "./TinyEngine/Externals/qoi.h"
 #define DEFAULT_FRAGMENT_SHADER "./Shaders/default_output_frag.spv"
 #define SPRITE_VERTEX_SHADER "./Shaders/texture_output_vert.spv"
 #define SPRITE_FRAGMENT_SHADER "./Shaders/texture_output_frag.spv"
@@ -14,6 +12,7 @@ int TINY_ENGINE_WINDOWMAIN {
     TinyVkDevice vkdevice(&window);
     TinyCommandPool cmdpool(vkdevice);
     TinyRenderGraph graph(vkdevice, &window);
+    graph.framePacing = TinyFramePacing::PACING_LOW_LATENCY;
 
     TinyShader vertexShader(TinyShaderStages::STAGE_VERTEX, SPRITE_VERTEX_SHADER, { sizeof(mat4) });
     TinyShader defaultFragShader(TinyShaderStages::STAGE_FRAGMENT, DEFAULT_FRAGMENT_SHADER);
@@ -24,6 +23,7 @@ int TINY_ENGINE_WINDOWMAIN {
     TinyPipeline pipeline3(vkdevice, TinyPipelineCreateInfo::PresentInfo(vertexShader, fragShader, true, false, true, VK_FORMAT_B8G8R8A8_UNORM));
 
     TinyImage targetImage(vkdevice, TinyImageType::TYPE_COLORATTACHMENT, window.hwndWidth, window.hwndHeight);
+    graph.ResizeImageWithSwapchain(&targetImage);
     
     std::vector<TinyRenderPass*> renderpass1 = graph.CreateRenderPass(cmdpool, pipeline1, VK_NULL_HANDLE, "Staging Data Pass", 1);
     std::vector<TinyRenderPass*> renderpass2 = graph.CreateRenderPass(cmdpool, pipeline2, &targetImage, "Render Pass", 1);
@@ -31,27 +31,40 @@ int TINY_ENGINE_WINDOWMAIN {
     renderpass2[0]->AddDependency(renderpass1[0]);
     renderpass3[0]->AddDependency(renderpass2[0]);
     
-    qoi_desc sourceImageDesc;
-    void* sourceImageData = qoi_read(DEFAULT_QOI_IMAGE, &sourceImageDesc, 4);
+    TinyThreadPool threadPool;
+    TinyMappedFile sourceImageFile(DEFAULT_QOI_IMAGE);
+    TinyImageDescription sourceImageDesc;
+    TinyImageLoader::ReadHeader(sourceImageFile.data, sourceImageFile.size, sourceImageDesc);
     TinyImage sourceImage(vkdevice, TinyImageType::TYPE_COLORATTACHMENT, sourceImageDesc.width, sourceImageDesc.height);
     
     TinyQuad imageQuad(vec2(500.0, 500.0), 1.0, vec2(0.0, 0.0), vec2(0.0, 0.0), vec2(0.0, 0.0), 0.0, vec4(0.0, 0.0, 1.0, 1.0));
     TinyQuad screenQuad(vec2(window.hwndWidth, window.hwndHeight), 1.0, vec2(0.0, 0.0), vec2(0.0, 0.0), vec2(0.0, 0.0), 0.0, vec4(0.0, 0.0, 1.0, 1.0));
 
-    size_t sizeofQuads = imageQuad.SizeofQuad() + screenQuad.SizeofQuad();
-    size_t sizeOfImage = sourceImageDesc.width * sourceImageDesc.height * sourceImageDesc.channels;
+    size_t sizeofQuads = imageQuad.SizeofIndexedQuad() + screenQuad.SizeofIndexedQuad();
+    size_t sizeOfImage = TinyImageLoader::SizeofStaged(sourceImageDesc, sourceImage.imageFormat);
     TinyBuffer vertexBuffer(vkdevice, TinyBufferType::TYPE_VERTEX, sizeofQuads);
-    TinyBuffer stagingBuffer(vkdevice, TinyBufferType::TYPE_STAGING, sizeofQuads + sizeOfImage);
+    TinyQuadIndexBuffer quadIndices(vkdevice, 2);
+    TinyBuffer stagingBuffer(vkdevice, TinyBufferType::TYPE_STAGING, sizeofQuads + quadIndices.size + sizeOfImage);
+
+    // Decodes the mapped image file (in parallel) straight into the staging buffer converted to the image's format (RGBA -> BGRA),
+    // it's copied to the image once on the first frame.
+    VkDeviceSize stageOffset = sizeofQuads + quadIndices.size, imageOffset = 0;
+    TinyImageLoader::LoadImage(sourceImageFile, stagingBuffer, stageOffset, sourceImageDesc, imageOffset, &threadPool, sourceImage.imageFormat);
+    bool sourceImageStaged = false;
 
     renderpass1[0]->renderEvent.hook(TinyRenderEvent([&](TinyRenderPass& renderPass, TinyRenderObject& renderer, bool frameResized) {
-        screenQuad.Resize(vec2(window.hwndWidth, window.hwndHeight));
-        std::vector<TinyVertex> quads = TinyQuad::GetVertexVector({ imageQuad.Vertices(), screenQuad.Vertices() });
+        // Resizable images may be allocated larger than the window, drawing the full allocation maps texels 1:1 (the rest is clipped).
+        screenQuad.Resize(vec2(targetImage.allocatedWidth, targetImage.allocatedHeight));
+        std::vector<TinyVertex> quads = TinyQuad::GetIndexedVertexVector({ imageQuad.IndexedVertices(), screenQuad.IndexedVertices() });
 
         VkDeviceSize offset = 0;
         renderer.StageBufferToBuffer(stagingBuffer, vertexBuffer, quads.data(), sizeofQuads, offset);
-        
-        VkDeviceSize byteSize = sourceImageDesc.width * sourceImageDesc.height * sourceImageDesc.channels;
-        renderer.StageBufferToImage(stagingBuffer, sourceImage, sourceImageData, { .extent = { sourceImageDesc.width, sourceImageDesc.height}, .offset = {0, 0} }, byteSize, offset);
+        quadIndices.Stage(renderer, stagingBuffer, offset);
+
+        if (!sourceImageStaged) {
+            renderer.CopyStagedToImage(stagingBuffer, sourceImage, { .extent = { sourceImageDesc.width, sourceImageDesc.height}, .offset = {0, 0} }, imageOffset);
+            sourceImageStaged = true;
+        }
     }));
 
     mat4 camera = TinyMath::Project2D(window.hwndWidth, window.hwndHeight, 0.0, 0.0, 1.0, 0.0);
@@ -61,7 +74,8 @@ int TINY_ENGINE_WINDOWMAIN {
         renderer.PushImage(sourceImage, 0);
         renderer.PushConstant(&camera, TinyShaderStages::STAGE_VERTEX, sizeof(mat4));
         renderer.BindVertices(vertexBuffer, 0);
-        renderer.DrawInstances(6, 1, 0, 0);
+        quadIndices.Bind(renderer);
+        renderer.DrawIndexed(6, 1, 0, 0, 0);
     }));
 
     renderpass3[0]->renderEvent.hook(TinyRenderEvent([&](TinyRenderPass& renderPass, TinyRenderObject& renderer, bool frameResized) {
@@ -69,12 +83,15 @@ int TINY_ENGINE_WINDOWMAIN {
         renderer.PushImage(targetImage, 0);
         renderer.PushConstant(&camera, TinyShaderStages::STAGE_VERTEX, sizeof(mat4));
         renderer.BindVertices(vertexBuffer, 0);
-        renderer.DrawInstances(6, 1, 6, 0);
+        quadIndices.Bind(renderer);
+        renderer.DrawIndexed(6, 1, 0, 4, 0);
     }));
     
     std::thread mythread([&window, &graph, &vkdevice]() {
         while (window.ShouldExecute()) {
-            graph.RenderSwapChain();
+            // Returns early (2ms timeout) while the frame fence/swapchain image is not ready, e.g. to run simulation or streaming work.
+            VkResult result = graph.RenderSwapChain(2000000ULL);
+            if (result == VK_TIMEOUT || result == VK_NOT_READY) continue;
 
             #if TINY_ENGINE_VALIDATION
                 for(TinyRenderPass* pass : graph.renderPasses) {
@@ -87,6 +104,9 @@ int TINY_ENGINE_WINDOWMAIN {
                         std::cout << "\t wait: " << dependency->title << " (" << dependency->subpassIndex << ")" << std::endl;
                 
                 }
+
+                std::cout << " - [" << graph.frameCounter << "] input to present: " << graph.frameStats.inputToPresent << " ms" << (graph.frameStats.presentMeasured? "" : " (estimated)")
+                    << ", record: " << graph.frameStats.cpuRecord << " ms, throttled: " << graph.frameStats.throttled << " ms" << std::endl;
             #endif
         }
     });